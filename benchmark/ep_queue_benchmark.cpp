@@ -0,0 +1,106 @@
+//
+//  ep_queue_benchmark.cpp
+//  mco
+//
+//  Compares the queue sizes and the peak memory of Martins and T-MDA.
+//  Since the peak resident set size is a property of the process, every
+//  run solves one instance with one algorithm:
+//
+//      ep_queue_benchmark martins instances/ep/grid50_50_7
+//      ep_queue_benchmark tmda instances/ep/grid50_50_7
+//
+
+#include <iostream>
+#include <string>
+#include <chrono>
+
+using std::cout;
+using std::cerr;
+using std::endl;
+using std::string;
+using std::chrono::steady_clock;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+
+#include <sys/resource.h>
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::EdgeArray;
+using ogdf::node;
+using ogdf::edge;
+
+#include <mco/basic/point.h>
+#include <mco/benchmarks/temporary_graphs_parser.h>
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/tmda/ep_solver_tmda.h>
+
+using mco::Point;
+using mco::TemporaryGraphParser;
+using mco::EpSolverMartins;
+using mco::EpSolverTMDA;
+
+int main(int argc, char** argv) {
+    if(argc < 3) {
+        cerr << "Usage: " << argv[0] << " <martins|tmda> <instance> [directed]" << endl;
+        return 1;
+    }
+
+    string algorithm(argv[1]);
+    string file_name(argv[2]);
+    bool directed = argc > 3 && string(argv[3]) == "directed";
+
+    Graph graph;
+    EdgeArray<Point> costs(graph);
+    unsigned dimension;
+    node source, target;
+
+    TemporaryGraphParser parser;
+    parser.getGraph(file_name, graph, costs, dimension, source, target);
+
+    auto cost_function = [&costs] (edge e) { return &costs[e]; };
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    long rss_before = usage.ru_maxrss;
+
+    unsigned number_of_points = 0;
+    unsigned max_queue_size = 0;
+
+    auto start = steady_clock::now();
+
+    if(algorithm == "martins") {
+        EpSolverMartins solver;
+        solver.set_verbose(false);
+        solver.Solve(graph, cost_function, dimension, source, target, directed);
+
+        number_of_points = solver.solutions().size();
+        max_queue_size = solver.max_queue_size();
+
+    } else if(algorithm == "tmda") {
+        EpSolverTMDA solver;
+        solver.Solve(graph, cost_function, dimension, source, target, directed);
+
+        number_of_points = solver.solutions().size();
+        max_queue_size = solver.max_queue_size();
+
+    } else {
+        cerr << "Unknown algorithm " << algorithm << endl;
+        return 1;
+    }
+
+    duration<double> time = duration_cast<duration<double>>(steady_clock::now() - start);
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    cout << "algorithm: " << algorithm << endl;
+    cout << "instance: " << file_name << endl;
+    cout << "points: " << number_of_points << endl;
+    cout << "max queue size: " << max_queue_size << endl;
+    cout << "time (s): " << time.count() << endl;
+    cout << "peak rss (kB): " << usage.ru_maxrss << endl;
+    cout << "peak rss after parsing (kB): " << rss_before << endl;
+
+    return 0;
+}
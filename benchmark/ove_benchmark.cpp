@@ -0,0 +1,429 @@
+//
+//  ove_benchmark.cpp
+//  mco
+//
+//  Compares the online vertex enumerators on the hyperplane streams of the
+//  dual Benson algorithm. The scalarizations are answered by a linear scan
+//  over a fixed set of value vectors, and only the calls to the enumerator
+//  are timed, so that the scalarization cost is not part of the
+//  measurement. The value vectors are either synthetic (points on a sphere,
+//  which are all extreme points) or read from a file with one value vector
+//  per line, e.g., the solutions of a recorded run.
+//
+//  Every enumerator runs in its own process for every dimension, such that
+//  the peak resident set size belongs to this run only. The results are
+//  written as a JSON array:
+//
+//      ove_benchmark -n 300 -d 3 -d 4 -d 5 -d 6 > ove.json
+//      ove_benchmark -e graphless -e cdd -f recorded_solutions.txt
+//
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <list>
+#include <random>
+#include <chrono>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+using std::cout;
+using std::cerr;
+using std::endl;
+using std::string;
+using std::vector;
+using std::list;
+using std::ifstream;
+using std::stringstream;
+using std::chrono::steady_clock;
+using std::chrono::duration;
+
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#include <tclap/CmdLine.h>
+
+using TCLAP::CmdLine;
+using TCLAP::ArgException;
+using TCLAP::ValueArg;
+using TCLAP::MultiArg;
+
+#include <mco/basic/point.h>
+#include <mco/generic/benson_dual/ove_node_lists.h>
+#include <mco/generic/benson_dual/ove_edge_lists.h>
+#include <mco/generic/benson_dual/ove_fp_v2.h>
+#include <mco/generic/benson_dual/ove_cdd.h>
+#include <mco/generic/benson_dual/ove_planar_subdivision.h>
+
+using mco::Point;
+using mco::NodeListVE;
+using mco::EdgeListVE;
+using mco::GraphlessOVE;
+using mco::OnlineVertexEnumeratorCDD;
+using mco::PlanarSubdivisionOVE;
+
+namespace {
+
+struct Run {
+    unsigned hyperplanes = 0;
+    unsigned candidates = 0;
+    unsigned permanent = 0;
+
+    // Time of all calls to the enumerator
+    double time = 0;
+
+    // Time of every add_hyperplane
+    vector<double> hyperplane_times;
+};
+
+vector<Point> sphere_points(unsigned dimension, unsigned number, unsigned seed) {
+    std::mt19937 generator(seed);
+    std::normal_distribution<double> normal;
+
+    vector<Point> points;
+    for(unsigned i = 0; i < number; ++i) {
+        Point point(dimension);
+
+        double norm = 0;
+        for(unsigned j = 0; j < dimension; ++j) {
+            point[j] = std::abs(normal(generator));
+            norm += point[j] * point[j];
+        }
+        norm = std::sqrt(norm);
+
+        for(unsigned j = 0; j < dimension; ++j) {
+            point[j] = 10 - 5 * point[j] / norm;
+        }
+
+        points.push_back(std::move(point));
+    }
+
+    return points;
+}
+
+vector<Point> read_points(const string& file_name) {
+    ifstream file(file_name);
+    if(!file) {
+        throw std::runtime_error("Could not open " + file_name);
+    }
+
+    vector<Point> points;
+    string line;
+    while(std::getline(file, line)) {
+        stringstream values(line);
+        vector<double> coordinates;
+
+        double value;
+        while(values >> value) {
+            coordinates.push_back(value);
+        }
+
+        if(coordinates.empty()) {
+            continue;
+        }
+
+        if(!points.empty() && coordinates.size() != points.front().dimension()) {
+            throw std::runtime_error("Value vectors of different dimensions in " + file_name);
+        }
+
+        Point point(coordinates.size());
+        std::copy(coordinates.begin(), coordinates.end(), point.begin());
+        points.push_back(std::move(point));
+    }
+
+    if(points.empty()) {
+        throw std::runtime_error("No value vectors in " + file_name);
+    }
+
+    return points;
+}
+
+double scalarize(const vector<Point>& points, const Point& weighting, Point& value) {
+    double best = std::numeric_limits<double>::infinity();
+    for(auto& point : points) {
+        double weighted_value = weighting * point;
+        if(weighted_value < best) {
+            best = weighted_value;
+            value = point;
+        }
+    }
+
+    return best;
+}
+
+// The loop of DualBensonScalarizer, where the calls to the enumerator are
+// timed
+template<typename OnlineVertexEnumerator>
+Run run(const vector<Point>& points, unsigned dimension, double epsilon) {
+    Run result;
+
+    Point weighting(dimension);
+    Point value(dimension);
+    Point inequality(dimension);
+
+    weighting[0] = 1;
+    scalarize(points, weighting, value);
+
+    auto start = steady_clock::now();
+
+    OnlineVertexEnumerator enumerator(value, dimension, epsilon);
+    delete enumerator.next_vertex();
+
+    result.time += duration<double>(steady_clock::now() - start).count();
+
+    while(true) {
+        start = steady_clock::now();
+
+        if(!enumerator.has_next()) {
+            result.time += duration<double>(steady_clock::now() - start).count();
+            break;
+        }
+
+        Point* candidate = enumerator.next_vertex();
+
+        result.time += duration<double>(steady_clock::now() - start).count();
+        ++result.candidates;
+
+        double sum = 0;
+        for(unsigned i = 0; i < dimension - 1; ++i) {
+            weighting[i] = (*candidate)[i];
+            sum += (*candidate)[i];
+        }
+        weighting[dimension - 1] = 1 - sum;
+
+        double scalar_value = scalarize(points, weighting, value);
+
+        if(scalar_value - (*candidate)[dimension - 1] > -epsilon) {
+            ++result.permanent;
+
+        } else {
+            for(unsigned i = 0; i < dimension - 1; ++i) {
+                inequality[i] = value[i] - value[dimension - 1];
+            }
+            inequality[dimension - 1] = -1;
+
+            start = steady_clock::now();
+
+            enumerator.add_hyperplane(*candidate, inequality, -value[dimension - 1]);
+
+            double time = duration<double>(steady_clock::now() - start).count();
+            result.time += time;
+            result.hyperplane_times.push_back(time);
+            ++result.hyperplanes;
+        }
+
+        delete candidate;
+    }
+
+    return result;
+}
+
+Run run(const string& enumerator,
+        const vector<Point>& points,
+        unsigned dimension,
+        double epsilon) {
+
+    if(enumerator == "node-lists") {
+        return run<NodeListVE>(points, dimension, epsilon);
+    } else if(enumerator == "edge-lists") {
+        return run<EdgeListVE>(points, dimension, epsilon);
+    } else if(enumerator == "graphless") {
+        return run<GraphlessOVE>(points, dimension, epsilon);
+    } else if(enumerator == "cdd") {
+        return run<OnlineVertexEnumeratorCDD>(points, dimension, epsilon);
+    } else if(enumerator == "planar") {
+        return run<PlanarSubdivisionOVE>(points, dimension, epsilon);
+    }
+
+    throw std::runtime_error("Unknown enumerator " + enumerator);
+}
+
+string to_json(const Run& run) {
+    vector<double> times = run.hyperplane_times;
+    std::sort(times.begin(), times.end());
+
+    double hyperplane_time = 0;
+    for(auto time : times) {
+        hyperplane_time += time;
+    }
+
+    double mean = times.empty() ? 0 : hyperplane_time / times.size();
+    double median = times.empty() ? 0 : times[times.size() / 2];
+    double maximum = times.empty() ? 0 : times.back();
+
+    stringstream json;
+    json << "\"hyperplanes\": " << run.hyperplanes
+        << ", \"candidates\": " << run.candidates
+        << ", \"permanent\": " << run.permanent
+        << ", \"time\": " << run.time
+        << ", \"time_per_hyperplane\": " << mean
+        << ", \"median_hyperplane_time\": " << median
+        << ", \"max_hyperplane_time\": " << maximum;
+
+    return json.str();
+}
+
+// Runs the enumerator in a child process, which writes its results to a
+// pipe. The peak resident set size is the one of the child.
+string benchmark(const string& enumerator,
+                 const vector<Point>& points,
+                 unsigned dimension,
+                 double epsilon,
+                 unsigned time_limit) {
+
+    int channel[2];
+    if(pipe(channel) != 0) {
+        throw std::runtime_error("Could not create a pipe");
+    }
+
+    pid_t child = fork();
+    if(child < 0) {
+        throw std::runtime_error("Could not fork");
+    }
+
+    if(child == 0) {
+        close(channel[0]);
+
+        // The child is killed by SIGALRM after the time limit
+        alarm(time_limit);
+
+        string json;
+        try {
+            json = to_json(run(enumerator, points, dimension, epsilon));
+        } catch(std::exception& e) {
+            json = "\"error\": \"" + string(e.what()) + "\"";
+        }
+
+        ssize_t written = write(channel[1], json.data(), json.size());
+        (void) written;
+        close(channel[1]);
+
+        _exit(0);
+    }
+
+    close(channel[1]);
+
+    string json;
+    char buffer[4096];
+    ssize_t length;
+    while((length = read(channel[0], buffer, sizeof(buffer))) > 0) {
+        json.append(buffer, length);
+    }
+    close(channel[0]);
+
+    int status;
+    struct rusage usage;
+    wait4(child, &status, 0, &usage);
+
+    stringstream result;
+    result << "{\"enumerator\": \"" << enumerator << "\""
+        << ", \"dimension\": " << dimension
+        << ", \"points\": " << points.size();
+
+    if(WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM) {
+        result << ", \"error\": \"time limit\"";
+    } else if(WIFSIGNALED(status) || json.empty()) {
+        result << ", \"error\": \"terminated\"";
+    } else {
+        result << ", " << json;
+    }
+
+    result << ", \"peak_rss_kb\": " << usage.ru_maxrss << "}";
+
+    return result.str();
+}
+
+}
+
+int main(int argc, char** argv) {
+    try {
+        CmdLine cmd("Benchmark of the online vertex enumerators of the dual Benson algorithm.", ' ', "0.1");
+
+        MultiArg<string> enumerator_argument("e", "enumerator", "Enumerator: node-lists, edge-lists, graphless, cdd or planar (default: all).", false, "enumerator");
+
+        MultiArg<unsigned> dimension_argument("d", "dimension", "Dimension of the synthetic value vectors (default: 3 to 6).", false, "dimension");
+
+        ValueArg<unsigned> points_argument("n", "points", "Number of synthetic value vectors.", false, 200, "points");
+
+        ValueArg<unsigned> seed_argument("s", "seed", "Seed of the synthetic value vectors.", false, 1, "seed");
+
+        ValueArg<string> file_argument("f", "file", "File with one value vector per line instead of synthetic ones.", false, "", "file");
+
+        ValueArg<unsigned> time_limit_argument("t", "time-limit", "Time limit of every run in seconds.", false, 600, "seconds");
+
+        ValueArg<double> epsilon_argument("", "epsilon", "Epsilon to be used in floating point calculations.", false, 1E-8, "epsilon");
+
+        cmd.add(enumerator_argument);
+        cmd.add(dimension_argument);
+        cmd.add(points_argument);
+        cmd.add(seed_argument);
+        cmd.add(file_argument);
+        cmd.add(time_limit_argument);
+        cmd.add(epsilon_argument);
+
+        cmd.parse(argc, argv);
+
+        vector<string> enumerators = enumerator_argument.getValue();
+        if(enumerators.empty()) {
+            enumerators = {"node-lists", "edge-lists", "graphless", "cdd", "planar"};
+        }
+
+        list<vector<Point>> point_sets;
+        if(file_argument.isSet()) {
+            point_sets.push_back(read_points(file_argument.getValue()));
+
+        } else {
+            vector<unsigned> dimensions = dimension_argument.getValue();
+            if(dimensions.empty()) {
+                dimensions = {3, 4, 5, 6};
+            }
+
+            for(auto dimension : dimensions) {
+                point_sets.push_back(sphere_points(dimension,
+                                                   points_argument.getValue(),
+                                                   seed_argument.getValue()));
+            }
+        }
+
+        bool first = true;
+        cout << "[" << endl;
+
+        for(auto& points : point_sets) {
+            unsigned dimension = points.front().dimension();
+
+            for(auto& enumerator : enumerators) {
+                // The planar subdivision only exists for three objectives
+                if(enumerator == "planar" && dimension != 3) {
+                    continue;
+                }
+
+                string result = benchmark(enumerator,
+                                          points,
+                                          dimension,
+                                          epsilon_argument.getValue(),
+                                          time_limit_argument.getValue());
+
+                cout << (first ? "" : ",\n") << "  " << result << std::flush;
+                first = false;
+            }
+        }
+
+        cout << endl << "]" << endl;
+
+    } catch(ArgException& e) {
+        cerr << "error: " << e.error() << " for arg " << e.argId() << endl;
+        return 1;
+    } catch(std::exception& e) {
+        cerr << "error: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
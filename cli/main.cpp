@@ -67,6 +67,11 @@ using mco::EqualityPointComparator;
 #include "basic/modules.h"
 #include "modules/ep_benson_module.h"
 #include "modules/ep_martins_module.h"
+#include "modules/ep_contraction_hierarchy_module.h"
+#include "modules/ep_server_module.h"
+#include "modules/ep_two_phase_module.h"
+#include "modules/ep_boa_star_module.h"
+#include "modules/ep_tmda_module.h"
 
 int main(int argc, char** argv) {
     try {
@@ -74,9 +79,19 @@ int main(int argc, char** argv) {
         
         EpBensonModule benson_module;
         EpMartinsModule martins_module;
+        EpContractionHierarchyModule contraction_hierarchy_module;
+        EpServerModule server_module;
+        EpTwoPhaseModule two_phase_module;
+        EpBOAStarModule boa_star_module;
+        EpTMDAModule tmda_module;
         
         module_factory.add_module("ep-dual-benson", benson_module);
         module_factory.add_module("ep-martins", martins_module);
+        module_factory.add_module("ep-ch", contraction_hierarchy_module);
+        module_factory.add_module("ep-server", server_module);
+        module_factory.add_module("ep-two-phase", two_phase_module);
+        module_factory.add_module("ep-boa-star", boa_star_module);
+        module_factory.add_module("ep-tmda", tmda_module);
         
         list<pair<unsigned, BasicModule*>> modules = module_factory.parse_module_list(argc, argv);
         
@@ -127,8 +142,10 @@ int main(int argc, char** argv) {
                                 argv + argument_position);
         
         
-        if(print_frontier || print_solutions || print_count) {
-            auto ep_algo_module = dynamic_cast<AlgorithmModule<list<edge>>*>(choosen_module);
+        auto ep_algo_module = dynamic_cast<AlgorithmModule<list<edge>>*>(choosen_module);
+        
+        if(ep_algo_module != nullptr &&
+           (print_frontier || print_solutions || print_count)) {
             
             auto solutions = ep_algo_module->solutions();
             
@@ -28,12 +28,16 @@ using TCLAP::CmdLine;
 using TCLAP::ArgException;
 using TCLAP::ValueArg;
 using TCLAP::UnlabeledValueArg;
+using TCLAP::SwitchArg;
 
 #include <mco/ep/dual_benson/ep_dual_benson.h>
+#include <mco/generic/benson_dual/ove_planar_subdivision.h>
 #include <mco/benchmarks/temporary_graphs_parser.h>
 #include <mco/basic/point.h>
 
 using mco::EPDualBensonSolver;
+using mco::EPDichotomicSolver;
+using mco::PlanarSubdivisionOVE;
 using mco::TemporaryGraphParser;
 using mco::Point;
 
@@ -43,9 +47,27 @@ void EpBensonModule::perform(int argc, char** argv) {
         
         ValueArg<double> epsilon_argument("e", "epsilon", "Epsilon to be used in floating point calculations.", false, 1E-8, "epsilon");
         
+        SwitchArg planar_argument("p", "planar", "Use the planar subdivision vertex enumerator for three objectives.", false);
+        
+        SwitchArg dichotomic_argument("d", "dichotomic", "Solve the scalarizations in parallel by the dichotomic scheme for two objectives.", false);
+        
+        ValueArg<double> approximation_argument("a", "approximation", "Relative tolerance of the approximation mode; 0 finds all extreme points.", false, 0, "tolerance");
+        
+        ValueArg<string> checkpoint_argument("k", "checkpoint", "File to which the state of the dual Benson algorithm is written.", false, "", "checkpoint");
+        
+        ValueArg<double> interval_argument("i", "interval", "Seconds between two checkpoints.", false, 600, "interval");
+        
+        SwitchArg resume_argument("r", "resume", "Continue from the checkpoint file.", false);
+        
         UnlabeledValueArg<string> file_name_argument("filename", "Name of the instance file", true, "","filename");
         
         cmd.add(epsilon_argument);
+        cmd.add(planar_argument);
+        cmd.add(dichotomic_argument);
+        cmd.add(approximation_argument);
+        cmd.add(checkpoint_argument);
+        cmd.add(interval_argument);
+        cmd.add(resume_argument);
         cmd.add(file_name_argument);
         
         cmd.parse(argc, argv);
@@ -62,15 +84,55 @@ void EpBensonModule::perform(int argc, char** argv) {
         
         parser.getGraph(file_name, graph, costs, dimension, source, target);
         
-        EPDualBensonSolver<> solver(epsilon);
-        
         auto cost_function = [costs] (edge e) { return &costs[e]; };
         
-        solver.Solve(graph, cost_function, source, target);
-        
-        solutions_.insert(solutions_.begin(),
-                          solver.solutions().cbegin(),
-                          solver.solutions().cend());
+        if(planar_argument.getValue() && dimension == 3) {
+            EPDualBensonSolver<PlanarSubdivisionOVE> solver(epsilon);
+            
+            solver.Solve(graph, cost_function, source, target);
+            
+            solutions_.insert(solutions_.begin(),
+                              solver.solutions().cbegin(),
+                              solver.solutions().cend());
+            
+        } else if(dichotomic_argument.getValue() && dimension == 2) {
+            EPDichotomicSolver solver(epsilon);
+            
+            solver.Solve(graph, cost_function, source, target);
+            
+            solutions_.insert(solutions_.begin(),
+                              solver.solutions().cbegin(),
+                              solver.solutions().cend());
+            
+        } else {
+            EPDualBensonSolver<> solver(epsilon);
+            
+            solver.set_approximation_tolerance(approximation_argument.getValue());
+            
+            if(!checkpoint_argument.isSet()) {
+                solver.Solve(graph, cost_function, source, target);
+            } else if(resume_argument.getValue()) {
+                solver.Resume(graph,
+                              cost_function,
+                              source,
+                              target,
+                              checkpoint_argument.getValue(),
+                              interval_argument.getValue());
+            } else {
+                solver.Solve(graph,
+                             cost_function,
+                             source,
+                             target,
+                             checkpoint_argument.getValue(),
+                             interval_argument.getValue());
+            }
+            
+            approximation_error_ = solver.approximation_error();
+            
+            solutions_.insert(solutions_.begin(),
+                              solver.solutions().cbegin(),
+                              solver.solutions().cend());
+        }
         
     } catch(ArgException& e) {
         std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
@@ -83,5 +145,10 @@ const list<pair<const list<edge>, const Point>>& EpBensonModule::solutions() {
 
 string EpBensonModule::statistics() {
     string stats("");
+    
+    if(approximation_error_ > 0) {
+        stats += "approximation error: " + std::to_string(approximation_error_);
+    }
+    
     return stats;
 }
@@ -27,6 +27,8 @@ public:
 private:
     
     std::list<std::pair<const std::list<ogdf::edge>, const mco::Point>> solutions_;
+    
+    double approximation_error_ = 0;
 
     
 };
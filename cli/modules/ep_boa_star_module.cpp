@@ -0,0 +1,96 @@
+//
+//  ep_boa_star_module.cpp
+//  mco
+//
+//
+
+#include "ep_boa_star_module.h"
+
+#include <string>
+
+using std::string;
+using std::list;
+using std::pair;
+using std::to_string;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::EdgeArray;
+using ogdf::node;
+using ogdf::edge;
+
+#include <tclap/CmdLine.h>
+
+using TCLAP::CmdLine;
+using TCLAP::ArgException;
+using TCLAP::ValueArg;
+using TCLAP::UnlabeledValueArg;
+using TCLAP::SwitchArg;
+
+#include <mco/ep/boa_star/ep_boa_star.h>
+#include <mco/benchmarks/temporary_graphs_parser.h>
+#include <mco/basic/point.h>
+
+using mco::TemporaryGraphParser;
+using mco::Point;
+using mco::EpSolverBOAStar;
+
+void EpBOAStarModule::perform(int argc, char** argv) {
+    try {
+        CmdLine cmd("Bi-objective A* to find the Pareto-frontier of bi-objective efficient path problems.", ' ', "0.1");
+        
+        ValueArg<double> epsilon_argument("e", "epsilon", "Epsilon to be used in floating point calculations.", false, 0, "epsilon");
+        
+        UnlabeledValueArg<string> file_name_argument("filename", "Name of the instance file", true, "","filename");
+        
+        SwitchArg is_directed_arg("d", "directed", "Should the input be interpreted as a directed graph?", false);
+        
+        cmd.add(epsilon_argument);
+        cmd.add(file_name_argument);
+        cmd.add(is_directed_arg);
+        
+        cmd.parse(argc, argv);
+        
+        string file_name = file_name_argument.getValue();
+        double epsilon = epsilon_argument.getValue();
+        bool is_directed = is_directed_arg.getValue();
+        
+        Graph graph;
+        EdgeArray<Point> costs(graph);
+        unsigned dimension;
+        node source, target;
+        
+        TemporaryGraphParser parser;
+        
+        parser.getGraph(file_name, graph, costs, dimension, source, target);
+        
+        if(dimension != 2) {
+            std::cerr << "error: " << file_name << " is not bi-objective" << std::endl;
+            return;
+        }
+        
+        auto cost_function = [&costs] (edge e) { return &costs[e]; };
+        
+        EpSolverBOAStar solver(epsilon);
+        solver.Solve(graph, cost_function, source, target, is_directed);
+        
+        solutions_.insert(solutions_.begin(),
+                          solver.solutions().cbegin(),
+                          solver.solutions().cend());
+        
+        statistics_ = "Created labels: " + to_string(solver.created_labels()) +
+            "\nExtracted labels: " + to_string(solver.extracted_labels());
+        
+    } catch(ArgException& e) {
+        std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+    }
+}
+
+const list<pair<const list<edge>, const Point>>& EpBOAStarModule::solutions() {
+    return solutions_;
+}
+
+string EpBOAStarModule::statistics() {
+    return statistics_;
+}
@@ -0,0 +1,124 @@
+//
+//  ep_contraction_hierarchy_module.cpp
+//  mco
+//
+//
+
+#include "ep_contraction_hierarchy_module.h"
+
+#include <string>
+#include <fstream>
+
+using std::string;
+using std::list;
+using std::pair;
+using std::ifstream;
+using std::ofstream;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::EdgeArray;
+using ogdf::node;
+using ogdf::edge;
+
+#include <tclap/CmdLine.h>
+
+using TCLAP::CmdLine;
+using TCLAP::ArgException;
+using TCLAP::ValueArg;
+using TCLAP::UnlabeledValueArg;
+using TCLAP::SwitchArg;
+
+#include <mco/ep/contraction/ep_contraction_hierarchy.h>
+#include <mco/benchmarks/temporary_graphs_parser.h>
+#include <mco/basic/point.h>
+
+using mco::TemporaryGraphParser;
+using mco::Point;
+using mco::EpContractionHierarchy;
+using mco::EpSolverContractionHierarchy;
+
+void EpContractionHierarchyModule::perform(int argc, char** argv) {
+    try {
+        CmdLine cmd("Multi-criteria contraction hierarchy to answer efficient path queries.", ' ', "0.1");
+        
+        ValueArg<double> epsilon_argument("e", "epsilon", "Epsilon to be used in floating point calculations.", false, 0, "epsilon");
+        
+        UnlabeledValueArg<string> file_name_argument("filename", "Name of the instance file", true, "","filename");
+        
+        SwitchArg is_directed_arg("d", "directed", "Should the input be interpreted as a directed graph?", false);
+        
+        ValueArg<string> read_hierarchy_arg("r", "read-hierarchy", "Reads the contraction hierarchy from the given file instead of building it.", false, "", "hierarchy file");
+        
+        ValueArg<string> write_hierarchy_arg("w", "write-hierarchy", "Writes the contraction hierarchy to the given file.", false, "", "hierarchy file");
+        
+        ValueArg<unsigned> witness_limit_arg("l", "witness-limit", "Maximum number of labels settled in a witness search.", false, 500, "labels");
+        
+        cmd.add(epsilon_argument);
+        cmd.add(file_name_argument);
+        cmd.add(is_directed_arg);
+        cmd.add(read_hierarchy_arg);
+        cmd.add(write_hierarchy_arg);
+        cmd.add(witness_limit_arg);
+        
+        cmd.parse(argc, argv);
+        
+        string file_name = file_name_argument.getValue();
+        double epsilon = epsilon_argument.getValue();
+        bool is_directed = is_directed_arg.getValue();
+        
+        Graph graph;
+        EdgeArray<Point> costs(graph);
+        unsigned dimension;
+        node source, target;
+        
+        TemporaryGraphParser parser;
+        
+        parser.getGraph(file_name, graph, costs, dimension, source, target);
+        
+        EpContractionHierarchy hierarchy(epsilon, witness_limit_arg.getValue());
+        
+        if(read_hierarchy_arg.isSet()) {
+            ifstream hierarchy_file(read_hierarchy_arg.getValue());
+            
+            if(!hierarchy.read(hierarchy_file, graph) ||
+               hierarchy.dimension() != dimension ||
+               hierarchy.directed() != is_directed) {
+                std::cerr << "error: " << read_hierarchy_arg.getValue()
+                    << " is not a hierarchy of " << file_name << std::endl;
+                return;
+            }
+            
+        } else {
+            auto cost_function = [&costs] (edge e) { return &costs[e]; };
+            
+            hierarchy.build(graph, cost_function, dimension, is_directed);
+        }
+        
+        if(write_hierarchy_arg.isSet()) {
+            ofstream hierarchy_file(write_hierarchy_arg.getValue());
+            hierarchy.write(hierarchy_file);
+        }
+        
+        EpSolverContractionHierarchy solver(hierarchy, epsilon);
+        solver.Solve(source, target);
+        
+        solutions_.insert(solutions_.begin(),
+                          solver.solutions().cbegin(),
+                          solver.solutions().cend());
+        
+        statistics_ = hierarchy.statistics();
+        
+    } catch(ArgException& e) {
+        std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+    }
+}
+
+const list<pair<const list<edge>, const Point>>& EpContractionHierarchyModule::solutions() {
+    return solutions_;
+}
+
+string EpContractionHierarchyModule::statistics() {
+    return statistics_;
+}
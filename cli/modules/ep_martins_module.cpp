@@ -11,6 +11,8 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <thread>
+#include <memory>
 
 using std::map;
 using std::string;
@@ -19,6 +21,8 @@ using std::pair;
 using std::make_pair;
 using std::function;
 using std::vector;
+using std::thread;
+using std::unique_ptr;
 
 #include <ogdf/basic/Graph.h>
 
@@ -39,16 +43,28 @@ using TCLAP::MultiArg;
 
 #include <mco/ep/basic/dijkstra.h>
 #include <mco/ep/martins/martins.h>
+#include <mco/ep/basic/ep_mapped_label_bags.h>
 #include <mco/ep/dual_benson/ep_dual_benson.h>
+#include <mco/ep/preprocessing/ep_graph_reduction.h>
+#include <mco/ep/preprocessing/ep_landmarks.h>
+#include <mco/ep/preprocessing/ep_lower_bound_sets.h>
 #include <mco/benchmarks/temporary_graphs_parser.h>
 #include <mco/basic/point.h>
+#include <mco/basic/concurrent_queue.h>
+#include <mco/basic/frontier_indicators.h>
 
 using mco::EPDualBensonSolver;
 using mco::TemporaryGraphParser;
 using mco::Point;
 using mco::EpSolverMartins;
+using mco::EpMappedLabelBags;
 using mco::Dijkstra;
 using mco::DijkstraModes;
+using mco::EpGraphReduction;
+using mco::EpLandmarks;
+using mco::EpLowerBoundSets;
+using mco::ConcurrentQueue;
+using mco::FrontierIndicators;
 
 void EpMartinsModule::perform(int argc, char** argv) {
     try {
@@ -64,6 +80,26 @@ void EpMartinsModule::perform(int argc, char** argv) {
         
         SwitchArg is_directed_arg("d", "directed", "Should the input be interpreted as a directed graph?", false);
         
+        SwitchArg do_pipelining_arg("P", "pipelined", "Runs the first phase concurrently to the search and seeds the search with every tree as soon as it is found. Implies -f.", false);
+        
+        SwitchArg do_reduction_arg("R", "reduce", "Reduce the graph before solving (unreachable and bounded nodes, dominated parallel edges, degree-2 chains)", false);
+        
+        ValueArg<unsigned> landmarks_arg("L", "landmarks", "Use lower bounds from the given number of landmarks instead of one Dijkstra per objective for the ideal point heuristic. Ideal bounds still refer to the exact ideal point.", false, 0, "landmarks");
+        
+        SwitchArg lower_bound_sets_arg("B", "lower-bound-sets", "Prune labels by lower bound sets of all nodes from the weighted sum trees rooted at the target", false);
+        
+        ValueArg<unsigned> label_budget_arg("M", "label-budget", "Maximum number of stored labels. Exceeding it switches to merging labels within a stepwise increasing relative tolerance, which yields an approximation of the frontier.", false, 0, "labels");
+        
+        ValueArg<double> budget_tolerance_arg("T", "budget-tolerance", "Initial relative tolerance of the approximated frontier once the label budget is exceeded.", false, 1E-3, "tolerance");
+        
+        ValueArg<string> spill_file_arg("S", "spill-file", "Spills the costs of reclaimed labels to this file once they exceed the spill limit.", false, "", "file");
+        
+        ValueArg<unsigned> spill_limit_arg("", "spill-limit", "Megabytes of reclaimed label costs kept in memory when spilling.", false, 256, "megabytes");
+        
+        ValueArg<unsigned> beam_width_arg("K", "beam-width", "Beam search keeping at most this many labels per node, chosen by crowding distance. Combine with -H to expand labels by their heuristic costs.", false, 0, "labels");
+        
+        SwitchArg compare_exact_arg("", "compare-exact", "Solves exactly as well and prints quality indicators of the beam search result.", false);
+        
         MultiArg<string> ideal_bounds_arg("I", "ideal-bound", "objective:factor", false,
                                      "Bounds the given objective function by factor times the ideal heuristic value of this objective function. Implies -H.");
         
@@ -76,6 +112,16 @@ void EpMartinsModule::perform(int argc, char** argv) {
         cmd.add(fractional_bounds_arg);
         cmd.add(is_directed_arg);
         cmd.add(do_first_phase_arg);
+        cmd.add(do_pipelining_arg);
+        cmd.add(do_reduction_arg);
+        cmd.add(landmarks_arg);
+        cmd.add(lower_bound_sets_arg);
+        cmd.add(label_budget_arg);
+        cmd.add(budget_tolerance_arg);
+        cmd.add(spill_file_arg);
+        cmd.add(spill_limit_arg);
+        cmd.add(beam_width_arg);
+        cmd.add(compare_exact_arg);
         
         cmd.parse(argc, argv);
         
@@ -84,6 +130,9 @@ void EpMartinsModule::perform(int argc, char** argv) {
         bool use_heuristic = use_heuristic_switch.getValue();
         bool is_directed = is_directed_arg.getValue();
         bool do_first_phase = do_first_phase_arg.getValue();
+        bool do_pipelining = do_pipelining_arg.getValue();
+        bool do_reduction = do_reduction_arg.getValue();
+        unsigned number_of_landmarks = landmarks_arg.getValue();
         
         if(ideal_bounds_arg.end() - ideal_bounds_arg.begin() > 0 ||
            fractional_bounds_arg.end() - fractional_bounds_arg.begin() > 0) {
@@ -100,8 +149,16 @@ void EpMartinsModule::perform(int argc, char** argv) {
         parser.getGraph(file_name, graph, costs, dimension, source, target);
         
         vector<NodeArray<double>> distances(dimension, graph);
-        
-        if(use_heuristic) {
+        EpLandmarks landmarks(number_of_landmarks);
+        bool use_landmarks = use_heuristic && number_of_landmarks > 0;
+        
+        if(use_landmarks) {
+            landmarks.compute(graph,
+                              [&costs] (edge e) { return &costs[e]; },
+                              dimension,
+                              is_directed);
+            
+        } else if(use_heuristic) {
             calculate_ideal_heuristic(graph,
                                       costs,
                                       dimension,
@@ -117,14 +174,44 @@ void EpMartinsModule::perform(int argc, char** argv) {
             }
         }
         
-        auto ideal_heuristic = [distances] (node n, unsigned objective) {
-            return distances[objective][n];
-        };
+        function<double(node, unsigned)> ideal_heuristic
+            = [distances] (node n, unsigned objective) {
+                return distances[objective][n];
+            };
+        
+        if(use_landmarks) {
+            ideal_heuristic = landmarks.heuristic(target);
+        }
+        
+        // The landmark lower bound at the source may be far below the ideal
+        // point, such that a bound relative to it cuts off every path. The
+        // ideal point is computed by one Dijkstra per bounded objective
+        // instead, as it is without landmarks.
+        function<double(node, unsigned)> ideal_point = ideal_heuristic;
+        
+        if(use_landmarks) {
+            ideal_point = [&graph, &costs, target] (node n, unsigned objective) {
+                Dijkstra<double> sssp_solver;
+                NodeArray<double> distances(graph);
+                NodeArray<edge> predecessor(graph);
+                
+                sssp_solver.singleSourceShortestPaths(graph,
+                                                      [&costs, objective] (edge e) {
+                                                          return costs[e][objective];
+                                                      },
+                                                      target,
+                                                      predecessor,
+                                                      distances,
+                                                      DijkstraModes::Undirected);
+                
+                return distances[n];
+            };
+        }
         
         Point bounds(numeric_limits<double>::infinity(), dimension);
         parse_ideal_bounds(ideal_bounds_arg,
                            dimension,
-                           ideal_heuristic,
+                           ideal_point,
                            source,
                            bounds);
         
@@ -132,35 +219,202 @@ void EpMartinsModule::perform(int argc, char** argv) {
                                 dimension,
                                 bounds);
         
-        auto cost_function = [&costs] (edge e) { return &costs[e]; };
+        Graph* instance_graph = &graph;
+        EdgeArray<Point>* instance_costs = &costs;
+        node instance_source = source;
+        node instance_target = target;
+        function<double(node, unsigned)> heuristic = ideal_heuristic;
+        
+        EpGraphReduction reduction(epsilon);
+        
+        if(do_reduction) {
+            vector<NodeArray<double>> source_distances;
+            vector<NodeArray<double>> target_distances;
+            
+            bool is_bounded = false;
+            for(unsigned i = 0; i < dimension; ++i) {
+                is_bounded = is_bounded || bounds[i] < numeric_limits<double>::infinity();
+            }
+            
+            // The heuristic values are the distances to the target, the
+            // distances from the source are obtained the same way
+            if(use_landmarks && is_bounded) {
+                source_distances.assign(dimension, NodeArray<double>(graph));
+                target_distances.assign(dimension, NodeArray<double>(graph));
+                
+                for(unsigned i = 0; i < dimension; ++i) {
+                    for(auto n : graph.nodes) {
+                        source_distances[i][n] = landmarks.lower_bound(source, n, i);
+                        target_distances[i][n] = ideal_heuristic(n, i);
+                    }
+                }
+                
+            } else if(use_heuristic && is_bounded) {
+                source_distances.assign(dimension, NodeArray<double>(graph));
+                calculate_ideal_heuristic(graph,
+                                          costs,
+                                          dimension,
+                                          target,
+                                          source,
+                                          source_distances);
+                
+                target_distances = distances;
+            }
+            
+            reduction.reduce(graph,
+                             costs,
+                             dimension,
+                             source,
+                             target,
+                             source_distances,
+                             target_distances,
+                             bounds,
+                             is_directed);
+            
+            cout << reduction.statistics() << endl;
+            
+            instance_graph = &reduction.graph();
+            instance_costs = &reduction.costs();
+            instance_source = reduction.source();
+            instance_target = reduction.target();
+            
+            heuristic = [&reduction, ideal_heuristic] (node n, unsigned objective) {
+                return ideal_heuristic(reduction.original_node(n), objective);
+            };
+        }
+        
+        auto cost_function = [instance_costs] (edge e) { return &(*instance_costs)[e]; };
         
         list<pair<NodeArray<Point *>, NodeArray<edge>>> solutions;
         
-        if(do_first_phase) {
-            first_phase(graph,
+        EpSolverMartins solver(epsilon);
+        
+        if(label_budget_arg.isSet()) {
+            solver.set_label_budget(label_budget_arg.getValue(),
+                                    budget_tolerance_arg.getValue());
+        }
+        
+        solver.set_beam_width(beam_width_arg.getValue());
+        
+        unique_ptr<EpMappedLabelBags> label_bags;
+        
+        if(spill_file_arg.isSet()) {
+            label_bags.reset(new EpMappedLabelBags(spill_file_arg.getValue(),
+                                                   (std::size_t) spill_limit_arg.getValue() << 20));
+            solver.set_label_bags(label_bags.get());
+        }
+        
+        ConcurrentQueue<pair<NodeArray<Point *>, NodeArray<edge>>> streamed_solutions;
+        thread first_phase_thread;
+        
+        if(do_pipelining) {
+            first_phase_thread = thread([&] () {
+                first_phase(*instance_graph,
+                            cost_function,
+                            dimension,
+                            instance_source,
+                            instance_target,
+                            epsilon,
+                            [&streamed_solutions] (pair<NodeArray<Point *>, NodeArray<edge>>&& solution) {
+                                streamed_solutions.push(std::move(solution));
+                            });
+            });
+            
+            solver.set_tree_stream([&streamed_solutions] (pair<NodeArray<Point *>, NodeArray<edge>>& solution) {
+                return streamed_solutions.try_pop(solution);
+            });
+            
+        } else if(do_first_phase) {
+            first_phase(*instance_graph,
                         cost_function,
                         dimension,
-                        source,
-                        target,
+                        instance_source,
+                        instance_target,
                         epsilon,
-                        solutions);
+                        [&solutions] (pair<NodeArray<Point *>, NodeArray<edge>>&& solution) {
+                            solutions.push_back(std::move(solution));
+                        });
+        }
+        
+        EpLowerBoundSets lower_bound_sets(epsilon == 0 ? 1E-8 : epsilon);
+        
+        if(lower_bound_sets_arg.getValue()) {
+            lower_bound_sets.compute(*instance_graph,
+                                     cost_function,
+                                     instance_source,
+                                     instance_target);
+            
+            cout << "Lower bound set hyperplanes: " << lower_bound_sets.number_of_hyperplanes() << endl;
+            
+            solver.set_lower_bound_sets(&lower_bound_sets);
         }
-
-        EpSolverMartins solver(epsilon);
         
-        solver.Solve(graph,
+        solver.Solve(*instance_graph,
                      cost_function,
                      dimension,
-                     source,
-                     target,
+                     instance_source,
+                     instance_target,
                      bounds,
                      solutions,
-                     ideal_heuristic,
+                     heuristic,
                      is_directed);
+        
+        if(do_pipelining) {
+            // The remaining trees cannot contribute after the search ended
+            first_phase_thread.join();
+            
+            pair<NodeArray<Point *>, NodeArray<edge>> solution;
+            while(streamed_solutions.try_pop(solution)) {
+                for(auto n : instance_graph->nodes) {
+                    delete solution.first[n];
+                }
+            }
+        }
 
-        solutions_.insert(solutions_.begin(),
-                          solver.solutions().cbegin(),
-                          solver.solutions().cend());
+        if(compare_exact_arg.getValue()) {
+            EpSolverMartins exact_solver(epsilon);
+            exact_solver.set_verbose(false);
+            
+            exact_solver.Solve(*instance_graph,
+                               cost_function,
+                               dimension,
+                               instance_source,
+                               instance_target,
+                               bounds,
+                               heuristic,
+                               list<Point>(),
+                               is_directed);
+            
+            vector<Point> approximation;
+            for(auto& solution : solver.solutions()) {
+                approximation.push_back(solution.second);
+            }
+            
+            vector<Point> frontier;
+            for(auto& solution : exact_solver.solutions()) {
+                frontier.push_back(solution.second);
+            }
+            
+            cout << "Exact frontier size: " << frontier.size() << endl;
+            cout << "Coverage: " << FrontierIndicators::coverage(approximation, frontier, 1E-6) << endl;
+            cout << "Multiplicative epsilon: " << FrontierIndicators::multiplicative_epsilon(approximation, frontier) << endl;
+            cout << "Additive epsilon: " << FrontierIndicators::additive_epsilon(approximation, frontier) << endl;
+            
+            if(dimension == 2) {
+                cout << "Hypervolume ratio: " << FrontierIndicators::hypervolume_ratio_2d(approximation, frontier) << endl;
+            }
+        }
+        
+        if(do_reduction) {
+            for(auto& solution : solver.solutions()) {
+                solutions_.push_back(make_pair(reduction.original_path(solution.first),
+                                               solution.second));
+            }
+        } else {
+            solutions_.insert(solutions_.begin(),
+                              solver.solutions().cbegin(),
+                              solver.solutions().cend());
+        }
         
     } catch(ArgException& e) {
         std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
@@ -263,13 +517,13 @@ void EpMartinsModule::first_phase(const Graph& graph,
                                   const node source,
                                   const node target,
                                   double epsilon,
-                                  list<pair<NodeArray<Point *>, NodeArray<edge>>>& solutions) {
+                                  function<void(pair<NodeArray<Point *>, NodeArray<edge>>&&)> receive) {
     
     if(epsilon == 0) {
         epsilon = 1E-8;
     }
     
-    auto callback = [&solutions, &graph, dimension] (NodeArray<Point *>& distances,
+    auto callback = [&receive, &graph, dimension] (NodeArray<Point *>& distances,
                                                      NodeArray<edge>& predecessors) {
         
         NodeArray<Point *> new_distances(graph);
@@ -281,7 +535,7 @@ void EpMartinsModule::first_phase(const Graph& graph,
             new_distances[n] = p;
         }
         
-        solutions.push_back(make_pair(new_distances, predecessors));
+        receive(make_pair(new_distances, predecessors));
     };
 
     {
@@ -49,7 +49,7 @@ private:
                      const ogdf::node source,
                      const ogdf::node target,
                      double epsilon,
-                     std::list<std::pair<ogdf::NodeArray<mco::Point *>, ogdf::NodeArray<ogdf::edge>>>& solutions);
+                     std::function<void(std::pair<ogdf::NodeArray<mco::Point *>, ogdf::NodeArray<ogdf::edge>>&&)> receive);
     
     std::list<std::pair<const std::list<ogdf::edge>, const mco::Point>> solutions_;
 
@@ -0,0 +1,352 @@
+//
+//  ep_server_module.cpp
+//  mco
+//
+//
+
+#include "ep_server_module.h"
+
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <utility>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <cstring>
+#include <cerrno>
+
+using std::string;
+using std::stringstream;
+using std::ifstream;
+using std::list;
+using std::pair;
+using std::shared_ptr;
+using std::make_shared;
+using std::mutex;
+using std::lock_guard;
+using std::thread;
+using std::atomic;
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <poll.h>
+#include <signal.h>
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::node;
+using ogdf::edge;
+
+#include <tclap/CmdLine.h>
+
+using TCLAP::CmdLine;
+using TCLAP::ArgException;
+using TCLAP::ValueArg;
+using TCLAP::UnlabeledValueArg;
+using TCLAP::SwitchArg;
+
+#include <mco/basic/point.h>
+#include <mco/basic/thread_pool.h>
+#include <mco/benchmarks/temporary_graphs_parser.h>
+#include <mco/ep/preprocessing/ep_landmarks.h>
+#include <mco/ep/contraction/ep_contraction_hierarchy.h>
+#include <mco/ep/server/ep_query_server.h>
+
+using mco::Point;
+using mco::ThreadPool;
+using mco::TemporaryGraphParser;
+using mco::EpLandmarks;
+using mco::EpContractionHierarchy;
+using mco::EpQueryServer;
+
+void EpServerModule::perform(int argc, char** argv) {
+    try {
+        CmdLine cmd("Answers efficient path queries \"source target [bounds]\" on one instance.", ' ', "0.1");
+
+        ValueArg<double> epsilon_argument("e", "epsilon", "Epsilon to be used in floating point calculations.", false, 0, "epsilon");
+
+        UnlabeledValueArg<string> file_name_argument("filename", "Name of the instance file", true, "","filename");
+
+        SwitchArg is_directed_arg("d", "directed", "Should the input be interpreted as a directed graph?", false);
+
+        ValueArg<unsigned> threads_arg("j", "threads", "Number of worker threads.", false, std::max(1u, thread::hardware_concurrency()), "threads");
+
+        ValueArg<unsigned> landmarks_arg("L", "landmarks", "Number of landmarks for the lower bounds used with bounded queries.", false, 8, "landmarks");
+
+        SwitchArg build_hierarchy_arg("C", "contraction-hierarchy", "Builds a contraction hierarchy to answer unbounded queries.", false);
+
+        ValueArg<string> read_hierarchy_arg("r", "read-hierarchy", "Reads a contraction hierarchy to answer unbounded queries.", false, "", "hierarchy file");
+
+        ValueArg<string> socket_arg("s", "socket", "Listens on the given UNIX socket instead of reading queries from stdin.", false, "", "socket path");
+
+        cmd.add(epsilon_argument);
+        cmd.add(file_name_argument);
+        cmd.add(is_directed_arg);
+        cmd.add(threads_arg);
+        cmd.add(landmarks_arg);
+        cmd.add(build_hierarchy_arg);
+        cmd.add(read_hierarchy_arg);
+        cmd.add(socket_arg);
+
+        cmd.parse(argc, argv);
+
+        string file_name = file_name_argument.getValue();
+        epsilon_ = epsilon_argument.getValue();
+        directed_ = is_directed_arg.getValue();
+
+        node source, target;
+
+        costs_.init(graph_);
+
+        TemporaryGraphParser parser;
+
+        parser.getGraph(file_name, graph_, costs_, dimension_, source, target);
+
+        auto cost_function = [this] (edge e) { return &costs_[e]; };
+
+        landmarks_.reset(new EpLandmarks(landmarks_arg.getValue()));
+        landmarks_->compute(graph_, cost_function, dimension_, directed_);
+
+        if(read_hierarchy_arg.isSet()) {
+            hierarchy_.reset(new EpContractionHierarchy(epsilon_));
+
+            ifstream hierarchy_file(read_hierarchy_arg.getValue());
+            if(!hierarchy_->read(hierarchy_file, graph_) ||
+               hierarchy_->dimension() != dimension_ ||
+               hierarchy_->directed() != directed_) {
+                std::cerr << "error: " << read_hierarchy_arg.getValue()
+                    << " is not a hierarchy of " << file_name << std::endl;
+                return;
+            }
+
+        } else if(build_hierarchy_arg.getValue()) {
+            hierarchy_.reset(new EpContractionHierarchy(epsilon_));
+            hierarchy_->build(graph_, cost_function, dimension_, directed_);
+        }
+
+        ThreadPool pool(threads_arg.getValue());
+
+        server_.reset(new EpQueryServer(graph_,
+                                        costs_,
+                                        dimension_,
+                                        directed_,
+                                        epsilon_,
+                                        *landmarks_,
+                                        hierarchy_.get(),
+                                        pool.size()));
+
+        if(socket_arg.isSet()) {
+            serve_socket(socket_arg.getValue(), pool);
+        } else {
+            server_->serve_stream(std::cin, std::cout, pool);
+        }
+
+    } catch(ArgException& e) {
+        std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+    }
+}
+
+void EpServerModule::serve_socket(const string& path, ThreadPool& pool) {
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if(server < 0 || path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "error: could not create socket " << path << std::endl;
+        return;
+    }
+
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    unlink(path.c_str());
+
+    if(bind(server, (sockaddr*) &address, sizeof(address)) < 0 ||
+       listen(server, 16) < 0) {
+        std::cerr << "error: could not listen on " << path << std::endl;
+        close(server);
+        return;
+    }
+
+    // A client sending "shutdown" writes to the pipe, which wakes the
+    // accept loop also where shutting down the listening socket does not
+    int stop[2];
+    if(pipe(stop) < 0) {
+        std::cerr << "error: could not create a pipe" << std::endl;
+        close(server);
+        return;
+    }
+
+    // Writing to a closed connection must not terminate the server
+    signal(SIGPIPE, SIG_IGN);
+
+    // Threads of the connections with a flag which is set once the client
+    // is served
+    list<pair<thread, shared_ptr<atomic<bool>>>> connections;
+
+    // Runs until a client sends "shutdown"
+    while(true) {
+        pollfd sockets[2];
+        sockets[0].fd = server;
+        sockets[0].events = POLLIN;
+        sockets[1].fd = stop[0];
+        sockets[1].events = POLLIN;
+
+        if(poll(sockets, 2, -1) < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        if(sockets[1].revents != 0 || (sockets[0].revents & (POLLERR | POLLNVAL)) != 0) {
+            break;
+        }
+
+        if((sockets[0].revents & POLLIN) == 0) {
+            continue;
+        }
+
+        int connection = accept(server, nullptr, nullptr);
+
+        if(connection < 0) {
+            if(errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            break;
+        }
+
+        {
+            lock_guard<mutex> lock(connections_mutex_);
+            open_connections_.insert(connection);
+        }
+
+        // Threads of closed connections are joined, so that a long running
+        // server only keeps the threads of its open connections
+        for(auto it = connections.begin(); it != connections.end();) {
+            if(*it->second) {
+                it->first.join();
+                it = connections.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        auto finished = make_shared<atomic<bool>>(false);
+
+        connections.emplace_back(thread([this, connection, &stop, &pool, finished] () {
+            serve_connection(connection, stop[1], pool);
+            *finished = true;
+        }), finished);
+    }
+
+    // Clients which stay connected would block their threads in read, so
+    // no more queries are read from them. Their pending answers are still
+    // written.
+    {
+        lock_guard<mutex> lock(connections_mutex_);
+        for(auto connection : open_connections_) {
+            ::shutdown(connection, SHUT_RD);
+        }
+    }
+
+    for(auto& connection : connections) {
+        connection.first.join();
+    }
+
+    pool.wait();
+
+    close(stop[0]);
+    close(stop[1]);
+    close(server);
+    unlink(path.c_str());
+}
+
+void EpServerModule::serve_connection(int connection, int stop, ThreadPool& pool) {
+
+    // The socket is closed when the last pending answer was written
+    struct Connection {
+        int socket;
+        mutex write_mutex;
+
+        ~Connection() {
+            close(socket);
+        }
+
+        void write_all(const string& data) {
+            lock_guard<mutex> lock(write_mutex);
+
+            size_t written = 0;
+            while(written < data.size()) {
+                ssize_t count = ::send(socket, data.data() + written, data.size() - written, 0);
+                if(count <= 0) {
+                    return;
+                }
+                written += count;
+            }
+        }
+    };
+
+    auto client = make_shared<Connection>();
+    client->socket = connection;
+
+    unsigned query_id = 0;
+    string buffer;
+    char data[4096];
+    bool reading = true;
+
+    while(reading) {
+        ssize_t count = read(connection, data, sizeof(data));
+        if(count <= 0) {
+            break;
+        }
+
+        buffer.append(data, count);
+
+        size_t line_end;
+        while(reading && (line_end = buffer.find('\n')) != string::npos) {
+            string query = buffer.substr(0, line_end);
+            buffer.erase(0, line_end + 1);
+
+            if(!query.empty() && query.back() == '\r') {
+                query.pop_back();
+            }
+
+            if(query.empty() || query[0] == '#') {
+                continue;
+            }
+
+            if(query == "quit") {
+                ::shutdown(connection, SHUT_RD);
+                reading = false;
+                continue;
+            }
+
+            if(query == "shutdown") {
+                char byte = 0;
+                ssize_t written = write(stop, &byte, 1);
+                (void) written;
+                reading = false;
+                continue;
+            }
+
+            unsigned id = query_id++;
+
+            pool.submit([this, client, query, id] (unsigned worker) {
+                stringstream response;
+                response << "query " << id << ": " << server_->answer(query, worker);
+                client->write_all(response.str());
+            });
+        }
+    }
+
+    // The socket stays open for the pending answers, but is not shut down
+    // by serve_socket anymore
+    lock_guard<mutex> lock(connections_mutex_);
+    open_connections_.erase(connection);
+}
@@ -0,0 +1,61 @@
+//
+//  ep_server_module.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_server_module__
+#define __mco__ep_server_module__
+
+#include <set>
+#include <string>
+#include <memory>
+#include <mutex>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/point.h>
+#include <mco/basic/thread_pool.h>
+#include <mco/ep/preprocessing/ep_landmarks.h>
+#include <mco/ep/contraction/ep_contraction_hierarchy.h>
+#include <mco/ep/server/ep_query_server.h>
+
+#include "../basic/modules.h"
+
+/**
+ * Loads an instance once and answers efficient path queries
+ * "source target [bound_1 ... bound_d]" read line by line from stdin or
+ * from the connections of a UNIX socket. The queries are solved
+ * concurrently on a worker pool by an EpQueryServer.
+ */
+class EpServerModule : public BasicModule {
+    
+public:
+    virtual void perform(int argc, char** args);
+    virtual ~EpServerModule() {}
+    
+private:
+    ogdf::Graph graph_;
+    ogdf::EdgeArray<mco::Point> costs_;
+    unsigned dimension_;
+    bool directed_;
+    double epsilon_;
+    
+    std::unique_ptr<mco::EpLandmarks> landmarks_;
+    std::unique_ptr<mco::EpContractionHierarchy> hierarchy_;
+    std::unique_ptr<mco::EpQueryServer> server_;
+    
+    // Sockets of the connections which are still read
+    std::set<int> open_connections_;
+    std::mutex connections_mutex_;
+    
+    void serve_socket(const std::string& path, mco::ThreadPool& pool);
+    
+    /**
+     * Reads the queries of connection. "shutdown" writes to stop, which
+     * ends the accept loop of serve_socket.
+     */
+    void serve_connection(int connection, int stop, mco::ThreadPool& pool);
+};
+
+#endif /* defined(__mco__ep_server_module__) */
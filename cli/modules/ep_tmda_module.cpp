@@ -0,0 +1,92 @@
+//
+//  ep_tmda_module.cpp
+//  mco
+//
+//
+
+#include "ep_tmda_module.h"
+
+#include <string>
+
+using std::string;
+using std::list;
+using std::pair;
+using std::to_string;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::EdgeArray;
+using ogdf::node;
+using ogdf::edge;
+
+#include <tclap/CmdLine.h>
+
+using TCLAP::CmdLine;
+using TCLAP::ArgException;
+using TCLAP::ValueArg;
+using TCLAP::UnlabeledValueArg;
+using TCLAP::SwitchArg;
+
+#include <mco/ep/tmda/ep_solver_tmda.h>
+#include <mco/benchmarks/temporary_graphs_parser.h>
+#include <mco/basic/point.h>
+
+using mco::TemporaryGraphParser;
+using mco::Point;
+using mco::EpSolverTMDA;
+
+void EpTMDAModule::perform(int argc, char** argv) {
+    try {
+        CmdLine cmd("Targeted multiobjective Dijkstra algorithm to find the Pareto-frontier of the efficient path problem.", ' ', "0.1");
+        
+        ValueArg<double> epsilon_argument("e", "epsilon", "Epsilon to be used in floating point calculations.", false, 0, "epsilon");
+        
+        UnlabeledValueArg<string> file_name_argument("filename", "Name of the instance file", true, "","filename");
+        
+        SwitchArg is_directed_arg("d", "directed", "Should the input be interpreted as a directed graph?", false);
+        
+        cmd.add(epsilon_argument);
+        cmd.add(file_name_argument);
+        cmd.add(is_directed_arg);
+        
+        cmd.parse(argc, argv);
+        
+        string file_name = file_name_argument.getValue();
+        double epsilon = epsilon_argument.getValue();
+        bool is_directed = is_directed_arg.getValue();
+        
+        Graph graph;
+        EdgeArray<Point> costs(graph);
+        unsigned dimension;
+        node source, target;
+        
+        TemporaryGraphParser parser;
+        
+        parser.getGraph(file_name, graph, costs, dimension, source, target);
+        
+        auto cost_function = [&costs] (edge e) { return &costs[e]; };
+        
+        EpSolverTMDA solver(epsilon);
+        solver.Solve(graph, cost_function, dimension, source, target, is_directed);
+        
+        solutions_.insert(solutions_.begin(),
+                          solver.solutions().cbegin(),
+                          solver.solutions().cend());
+        
+        statistics_ = "Created labels: " + to_string(solver.created_labels()) +
+            "\nMaximum queue size: " + to_string(solver.max_queue_size()) +
+            "\nMaximum stored labels: " + to_string(solver.max_stored_labels());
+        
+    } catch(ArgException& e) {
+        std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+    }
+}
+
+const list<pair<const list<edge>, const Point>>& EpTMDAModule::solutions() {
+    return solutions_;
+}
+
+string EpTMDAModule::statistics() {
+    return statistics_;
+}
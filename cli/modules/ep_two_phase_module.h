@@ -0,0 +1,33 @@
+//
+//  ep_two_phase_module.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_two_phase_module__
+#define __mco__ep_two_phase_module__
+
+#include <list>
+#include <string>
+
+#include <ogdf/basic/Graph.h>
+
+#include "../basic/modules.h"
+
+class EpTwoPhaseModule : public AlgorithmModule<std::list<ogdf::edge>> {
+    
+public:
+    virtual void perform(int argc, char** args);
+    virtual ~EpTwoPhaseModule() {}
+    
+    virtual const std::list<std::pair<const std::list<ogdf::edge>, const mco::Point>>& solutions();
+    virtual std::string statistics();
+    
+private:
+    
+    std::list<std::pair<const std::list<ogdf::edge>, const mco::Point>> solutions_;
+    std::string statistics_;
+    
+};
+
+#endif /* defined(__mco__ep_two_phase_module__) */
@@ -9,6 +9,8 @@
 #ifndef AP_BENSON_DUAL_SOLVER_H_
 #define AP_BENSON_DUAL_SOLVER_H_
 
+#include <thread>
+#include <algorithm>
 #include <functional>
 
 #include <mco/basic/abstract_solver.h>
@@ -17,6 +19,8 @@
 #include <mco/ap/basic/ap_instance.h>
 #include <mco/ap/basic/lex_hungarian.h>
 #include <mco/generic/benson_dual/dual_benson_scalarizer.h>
+#include <mco/generic/benson_dual/dichotomic_scalarizer.h>
+#include <mco/generic/benson_dual/scalarization_cache.h>
 #include <mco/generic/benson_dual/ove_fp_v2.h>
 
 namespace mco {
@@ -46,7 +50,7 @@ public:
 		std::list<Point *> frontier;
         
         DualBensonScalarizer<OnlineVertexEnumerator>
-        dual_benson_solver_(LexHungarianSolverAdaptor(instance),
+        dual_benson_solver_(ScalarizationCache(LexHungarianSolverAdaptor(instance), epsilon_),
                             instance.dimension(),
                             epsilon_);
         
@@ -65,6 +69,47 @@ private:
     double epsilon_;
 };
     
+/**
+ * Same extreme points as APBensonDualSolver for two objectives, where the
+ * scalarizations are solved in parallel by the dichotomic scheme.
+ */
+class APDichotomicSolver
+: public AbstractSolver<std::list<ogdf::edge>> {
+    
+public:
+    APDichotomicSolver(double epsilon = 1E-8,
+                       unsigned number_of_threads
+                       = std::max(1u, std::thread::hardware_concurrency()))
+    :   epsilon_(epsilon),
+        number_of_threads_(number_of_threads) { }
+    
+    void Solve(AssignmentInstance & instance) {
+        
+        std::list<Point *> frontier;
+        
+        DichotomicScalarizer
+        dichotomic_solver([&instance] () {
+                              return LexHungarianSolverAdaptor(instance);
+                          },
+                          epsilon_,
+                          number_of_threads_);
+        
+        dichotomic_solver.Calculate_solutions(frontier);
+        
+        std::list<std::pair<std::list<ogdf::edge>, Point>> solutions;
+        
+        for(auto point : frontier) {
+            solutions.push_back(make_pair(std::list<ogdf::edge>(), *point));
+            delete point;
+        }
+        
+        add_solutions(solutions.begin(), solutions.end());
+    }
+    
+private:
+    double epsilon_;
+    unsigned number_of_threads_;
+};
         
     
 inline LexHungarianSolverAdaptor::
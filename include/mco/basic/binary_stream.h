@@ -0,0 +1,87 @@
+//
+//  binary_stream.h
+//  mco
+//
+//
+
+#ifndef __mco__binary_stream__
+#define __mco__binary_stream__
+
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+#include <mco/basic/point.h>
+
+namespace mco {
+
+/**
+ * Reading and writing of numbers and points in the native binary
+ * representation, e.g., for checkpoints which are only read on the same
+ * machine.
+ */
+class BinaryStream {
+public:
+    template<typename T>
+    inline static void write(std::ostream& stream, T value);
+
+    inline static void write(std::ostream& stream, const Point& point);
+
+    /**
+     * Throws std::runtime_error if the stream ends before.
+     */
+    template<typename T>
+    inline static T read(std::istream& stream);
+
+    inline static Point read_point(std::istream& stream);
+};
+
+template<typename T>
+inline void BinaryStream::
+write(std::ostream& stream, T value) {
+    static_assert(std::is_arithmetic<T>::value,
+                  "Only numbers are written directly");
+
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+inline void BinaryStream::
+write(std::ostream& stream, const Point& point) {
+    write<unsigned>(stream, point.dimension());
+
+    for(auto value = point.cbegin(); value != point.cend(); ++value) {
+        write<double>(stream, *value);
+    }
+}
+
+template<typename T>
+inline T BinaryStream::
+read(std::istream& stream) {
+    static_assert(std::is_arithmetic<T>::value,
+                  "Only numbers are read directly");
+
+    T value;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+
+    if(!stream) {
+        throw std::runtime_error("Unexpected end of binary stream");
+    }
+
+    return value;
+}
+
+inline Point BinaryStream::
+read_point(std::istream& stream) {
+    Point point(read<unsigned>(stream));
+
+    for(auto value = point.begin(); value != point.end(); ++value) {
+        *value = read<double>(stream);
+    }
+
+    return point;
+}
+
+}
+
+#endif /* defined(__mco__binary_stream__) */
@@ -0,0 +1,72 @@
+//
+//  concurrent_queue.h
+//  mco
+//
+//
+
+#ifndef __mco__concurrent_queue__
+#define __mco__concurrent_queue__
+
+#include <queue>
+#include <mutex>
+#include <atomic>
+
+namespace mco {
+
+/**
+ * FIFO queue for passing data from a producing to a consuming thread. The
+ * consumer polls without blocking; polling an empty queue does not lock.
+ */
+template<typename T>
+class ConcurrentQueue {
+public:
+    ConcurrentQueue()
+    :   size_(0) { }
+
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+    inline void push(T value);
+
+    /**
+     * Moves the front element to value and returns true, or returns false
+     * if the queue is empty.
+     */
+    inline bool try_pop(T& value);
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+private:
+    std::queue<T> queue_;
+    std::mutex mutex_;
+    std::atomic<unsigned> size_;
+};
+
+template<typename T>
+inline void ConcurrentQueue<T>::
+push(T value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(std::move(value));
+    ++size_;
+}
+
+template<typename T>
+inline bool ConcurrentQueue<T>::
+try_pop(T& value) {
+    if(size_ == 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    value = std::move(queue_.front());
+    queue_.pop();
+    --size_;
+
+    return true;
+}
+
+}
+
+#endif /* defined(__mco__concurrent_queue__) */
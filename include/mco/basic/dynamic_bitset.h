@@ -0,0 +1,180 @@
+//
+//  dynamic_bitset.h
+//  mco
+//
+//
+
+#ifndef __mco__dynamic_bitset__
+#define __mco__dynamic_bitset__
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+namespace mco {
+
+/**
+ * A set of unsigned integers packed into 64 bit words, which grows on
+ * insertion. Intersections are counted word by word with popcount, so that
+ * no intersection has to be materialized.
+ */
+class DynamicBitset {
+public:
+    inline void set(unsigned index);
+
+    inline void reset(unsigned index);
+
+    inline bool test(unsigned index) const;
+
+    /**
+     * Number of elements in the set.
+     */
+    inline unsigned count() const;
+
+    /**
+     * Number of elements in the intersection with other.
+     */
+    inline unsigned intersection_count(const DynamicBitset& other) const;
+
+    /**
+     * Checks if the intersection with other contains an element not smaller
+     * than first.
+     */
+    inline bool intersects_from(const DynamicBitset& other,
+                                unsigned first) const;
+
+    /**
+     * Checks if every element of the set is an element of other.
+     */
+    inline bool is_subset_of(const DynamicBitset& other) const;
+
+    inline static DynamicBitset intersection(const DynamicBitset& set1,
+                                             const DynamicBitset& set2);
+
+    /**
+     * Calls function with every element in increasing order.
+     */
+    template<typename Function>
+    inline void for_each(Function function) const;
+
+private:
+    static const unsigned word_bits = 64;
+
+    std::vector<std::uint64_t> words_;
+
+    inline static unsigned popcount(std::uint64_t word);
+};
+
+inline void DynamicBitset::
+set(unsigned index) {
+    if(index / word_bits >= words_.size()) {
+        words_.resize(index / word_bits + 1, 0);
+    }
+
+    words_[index / word_bits] |= std::uint64_t(1) << (index % word_bits);
+}
+
+inline void DynamicBitset::
+reset(unsigned index) {
+    if(index / word_bits < words_.size()) {
+        words_[index / word_bits] &= ~(std::uint64_t(1) << (index % word_bits));
+    }
+}
+
+inline bool DynamicBitset::
+test(unsigned index) const {
+    return index / word_bits < words_.size() &&
+        (words_[index / word_bits] >> (index % word_bits) & 1);
+}
+
+inline unsigned DynamicBitset::
+count() const {
+    unsigned count = 0;
+    for(auto word : words_) {
+        count += popcount(word);
+    }
+
+    return count;
+}
+
+inline unsigned DynamicBitset::
+intersection_count(const DynamicBitset& other) const {
+    std::size_t size = std::min(words_.size(), other.words_.size());
+
+    unsigned count = 0;
+    for(std::size_t i = 0; i < size; ++i) {
+        count += popcount(words_[i] & other.words_[i]);
+    }
+
+    return count;
+}
+
+inline bool DynamicBitset::
+intersects_from(const DynamicBitset& other, unsigned first) const {
+    std::size_t size = std::min(words_.size(), other.words_.size());
+
+    std::size_t i = first / word_bits;
+    if(i >= size) {
+        return false;
+    }
+
+    // Mask the elements smaller than first in the first word
+    if((words_[i] & other.words_[i]) >> (first % word_bits) != 0) {
+        return true;
+    }
+
+    for(++i; i < size; ++i) {
+        if((words_[i] & other.words_[i]) != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline bool DynamicBitset::
+is_subset_of(const DynamicBitset& other) const {
+    for(std::size_t i = 0; i < words_.size(); ++i) {
+        std::uint64_t other_word = i < other.words_.size() ? other.words_[i] : 0;
+        if((words_[i] & ~other_word) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+inline DynamicBitset DynamicBitset::
+intersection(const DynamicBitset& set1, const DynamicBitset& set2) {
+    DynamicBitset result;
+    std::size_t size = std::min(set1.words_.size(), set2.words_.size());
+
+    result.words_.resize(size);
+    for(std::size_t i = 0; i < size; ++i) {
+        result.words_[i] = set1.words_[i] & set2.words_[i];
+    }
+
+    return result;
+}
+
+template<typename Function>
+inline void DynamicBitset::
+for_each(Function function) const {
+    for(std::size_t i = 0; i < words_.size(); ++i) {
+        std::uint64_t word = words_[i];
+        while(word != 0) {
+            unsigned bit = __builtin_ctzll(word);
+            function(static_cast<unsigned>(i * word_bits + bit));
+            word &= word - 1;
+        }
+    }
+}
+
+inline unsigned DynamicBitset::
+popcount(std::uint64_t word) {
+    return __builtin_popcountll(word);
+}
+
+}
+
+#endif /* defined(__mco__dynamic_bitset__) */
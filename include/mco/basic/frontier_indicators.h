@@ -0,0 +1,195 @@
+//
+//  frontier_indicators.h
+//  mco
+//
+//
+
+#ifndef __mco__frontier_indicators__
+#define __mco__frontier_indicators__
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cassert>
+
+#include <mco/basic/point.h>
+
+namespace mco {
+
+/**
+ * Quality indicators of an approximation of a frontier given by a
+ * reference set, e.g., the Pareto-frontier. All objectives are minimized.
+ */
+class FrontierIndicators {
+public:
+    /**
+     * Smallest epsilon such that every reference point r is weakly
+     * dominated by (1 + epsilon) r for some point of the approximation.
+     * Assumes nonnegative points. Infinity if the approximation is empty.
+     */
+    inline static double multiplicative_epsilon(const std::vector<Point>& approximation,
+                                                const std::vector<Point>& reference);
+
+    /**
+     * Smallest epsilon such that every reference point r is weakly
+     * dominated by r + epsilon for some point of the approximation.
+     */
+    inline static double additive_epsilon(const std::vector<Point>& approximation,
+                                          const std::vector<Point>& reference);
+
+    /**
+     * Fraction of the reference points weakly dominated by some point of
+     * the approximation up to epsilon in every objective.
+     */
+    inline static double coverage(const std::vector<Point>& approximation,
+                                  const std::vector<Point>& reference,
+                                  double epsilon = 0);
+
+    /**
+     * Area weakly dominated by the bi-objective points and bounded by the
+     * reference point.
+     */
+    inline static double hypervolume_2d(std::vector<Point> points,
+                                        const Point& reference_point);
+
+    /**
+     * Hypervolume of the approximation divided by the hypervolume of the
+     * reference set, both bounded by the componentwise maximum of all
+     * points plus one.
+     */
+    inline static double hypervolume_ratio_2d(const std::vector<Point>& approximation,
+                                              const std::vector<Point>& reference);
+};
+
+inline double FrontierIndicators::
+multiplicative_epsilon(const std::vector<Point>& approximation,
+                       const std::vector<Point>& reference) {
+
+    double epsilon = 0;
+
+    for(auto& r : reference) {
+        double best = std::numeric_limits<double>::infinity();
+
+        for(auto& a : approximation) {
+            double factor = 1;
+            for(unsigned i = 0; i < r.dimension(); ++i) {
+                if(a[i] <= r[i]) {
+                    continue;
+                }
+
+                factor = r[i] > 0 ? std::max(factor, a[i] / r[i]) :
+                    std::numeric_limits<double>::infinity();
+            }
+
+            best = std::min(best, factor);
+        }
+
+        epsilon = std::max(epsilon, best - 1);
+    }
+
+    return epsilon;
+}
+
+inline double FrontierIndicators::
+additive_epsilon(const std::vector<Point>& approximation,
+                 const std::vector<Point>& reference) {
+
+    double epsilon = 0;
+
+    for(auto& r : reference) {
+        double best = std::numeric_limits<double>::infinity();
+
+        for(auto& a : approximation) {
+            double difference = 0;
+            for(unsigned i = 0; i < r.dimension(); ++i) {
+                difference = std::max(difference, a[i] - r[i]);
+            }
+
+            best = std::min(best, difference);
+        }
+
+        epsilon = std::max(epsilon, best);
+    }
+
+    return epsilon;
+}
+
+inline double FrontierIndicators::
+coverage(const std::vector<Point>& approximation,
+         const std::vector<Point>& reference,
+         double epsilon) {
+
+    if(reference.empty()) {
+        return 1;
+    }
+
+    unsigned covered = 0;
+
+    for(auto& r : reference) {
+        for(auto& a : approximation) {
+            unsigned i = 0;
+            while(i < r.dimension() && a[i] <= r[i] + epsilon) {
+                ++i;
+            }
+
+            if(i == r.dimension()) {
+                ++covered;
+                break;
+            }
+        }
+    }
+
+    return static_cast<double>(covered) / reference.size();
+}
+
+inline double FrontierIndicators::
+hypervolume_2d(std::vector<Point> points,
+               const Point& reference_point) {
+
+    assert(reference_point.dimension() == 2);
+
+    std::sort(points.begin(), points.end(), [] (const Point& p1, const Point& p2) {
+        return p1[0] < p2[0] || (p1[0] == p2[0] && p1[1] < p2[1]);
+    });
+
+    // Sweep by the first objective over the staircase of the points
+    double volume = 0;
+    double last_y = reference_point[1];
+
+    for(auto& p : points) {
+        if(p[0] >= reference_point[0] || p[1] >= last_y) {
+            continue;
+        }
+
+        volume += (reference_point[0] - p[0]) * (last_y - p[1]);
+        last_y = p[1];
+    }
+
+    return volume;
+}
+
+inline double FrontierIndicators::
+hypervolume_ratio_2d(const std::vector<Point>& approximation,
+                     const std::vector<Point>& reference) {
+
+    Point reference_point(-std::numeric_limits<double>::infinity(), 2);
+
+    for(auto points : {&approximation, &reference}) {
+        for(auto& p : *points) {
+            reference_point[0] = std::max(reference_point[0], p[0] + 1);
+            reference_point[1] = std::max(reference_point[1], p[1] + 1);
+        }
+    }
+
+    double reference_volume = hypervolume_2d(reference, reference_point);
+
+    if(reference_volume == 0) {
+        return 1;
+    }
+
+    return hypervolume_2d(approximation, reference_point) / reference_volume;
+}
+
+}
+
+#endif /* defined(__mco__frontier_indicators__) */
@@ -0,0 +1,128 @@
+//
+//  local_upper_bounds.h
+//  mco
+//
+//
+
+#ifndef __mco__local_upper_bounds__
+#define __mco__local_upper_bounds__
+
+#include <vector>
+
+#include <mco/basic/point.h>
+
+namespace mco {
+
+/**
+ * Local upper bounds of a set N of points (Klamroth, Lacour, Vanderpooten:
+ * On the representation of the search region in multi-objective
+ * optimization). A point y is not weakly dominated by any point of N and
+ * lies below the initial bound iff y < u componentwise for some local
+ * upper bound u. Updates use the naive filtering of redundant bounds.
+ */
+class LocalUpperBounds {
+public:
+    explicit LocalUpperBounds(const Point& bound)
+    :   bounds_(1, bound) { }
+
+    /**
+     * Adds the point to N.
+     */
+    inline void add(const Point& point);
+
+    const std::vector<Point>& bounds() const {
+        return bounds_;
+    }
+
+    /**
+     * Returns whether point is not weakly dominated by any point of N.
+     */
+    inline bool in_search_region(const Point& point) const;
+
+private:
+    std::vector<Point> bounds_;
+
+    inline static bool is_less(const Point& p1, const Point& p2);
+    inline static bool is_leq(const Point& p1, const Point& p2);
+};
+
+inline bool LocalUpperBounds::
+is_less(const Point& p1, const Point& p2) {
+    for(unsigned i = 0; i < p1.dimension(); ++i) {
+        if(!(p1[i] < p2[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool LocalUpperBounds::
+is_leq(const Point& p1, const Point& p2) {
+    for(unsigned i = 0; i < p1.dimension(); ++i) {
+        if(p1[i] > p2[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline void LocalUpperBounds::
+add(const Point& point) {
+    std::vector<Point> bounds;
+    std::vector<Point> projections;
+
+    for(auto& bound : bounds_) {
+        if(!is_less(point, bound)) {
+            bounds.push_back(bound);
+            continue;
+        }
+
+        for(unsigned j = 0; j < point.dimension(); ++j) {
+            Point projection = bound;
+            projection[j] = point[j];
+            projections.push_back(std::move(projection));
+        }
+    }
+
+    if(projections.empty()) {
+        return;
+    }
+
+    unsigned number_of_bounds = bounds.size();
+
+    // A projection is redundant if it lies below another bound. Among
+    // equal projections, only the first one is kept.
+    for(unsigned i = 0; i < projections.size(); ++i) {
+        bool redundant = false;
+
+        for(unsigned j = 0; j < number_of_bounds && !redundant; ++j) {
+            redundant = is_leq(projections[i], bounds[j]);
+        }
+
+        for(unsigned j = 0; j < projections.size() && !redundant; ++j) {
+            if(i != j && is_leq(projections[i], projections[j])) {
+                redundant = !is_leq(projections[j], projections[i]) || j < i;
+            }
+        }
+
+        if(!redundant) {
+            bounds.push_back(projections[i]);
+        }
+    }
+
+    bounds_ = std::move(bounds);
+}
+
+inline bool LocalUpperBounds::
+in_search_region(const Point& point) const {
+    for(auto& bound : bounds_) {
+        if(is_less(point, bound)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+#endif /* defined(__mco__local_upper_bounds__) */
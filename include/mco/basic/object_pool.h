@@ -0,0 +1,119 @@
+//
+//  object_pool.h
+//  mco
+//
+//
+
+#ifndef __mco__object_pool__
+#define __mco__object_pool__
+
+#include <vector>
+#include <memory>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+namespace mco {
+
+/**
+ * Allocates objects of type T in blocks of slots. Slots of destroyed objects
+ * are reused by later objects. All objects which are still alive are
+ * destroyed together with the pool.
+ */
+template<typename T>
+class ObjectPool {
+public:
+    explicit ObjectPool(std::size_t block_size = 256)
+    :   block_size_(block_size) { }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    inline ~ObjectPool();
+
+    template<typename... Args>
+    inline T* create(Args&&... args);
+
+    inline void destroy(T* object);
+
+    /**
+     * Number of objects alive.
+     */
+    std::size_t size() const {
+        return size_;
+    }
+
+    /**
+     * Number of slots in all blocks.
+     */
+    std::size_t capacity() const {
+        return blocks_.size() * block_size_;
+    }
+
+private:
+    // The storage is the first member, so that an object and its slot
+    // share their address
+    struct Slot {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        bool alive;
+    };
+
+    const std::size_t block_size_;
+
+    std::vector<std::unique_ptr<Slot[]>> blocks_;
+    std::vector<Slot*> free_slots_;
+    std::size_t size_ = 0;
+};
+
+template<typename T>
+inline ObjectPool<T>::
+~ObjectPool() {
+    for(auto& block : blocks_) {
+        for(std::size_t i = 0; i < block_size_; ++i) {
+            if(block[i].alive) {
+                destroy(reinterpret_cast<T*>(&block[i].storage));
+            }
+        }
+    }
+}
+
+template<typename T>
+template<typename... Args>
+inline T* ObjectPool<T>::
+create(Args&&... args) {
+    if(free_slots_.empty()) {
+        blocks_.emplace_back(new Slot[block_size_]);
+
+        Slot* block = blocks_.back().get();
+        for(std::size_t i = block_size_; i > 0; --i) {
+            block[i - 1].alive = false;
+            free_slots_.push_back(&block[i - 1]);
+        }
+    }
+
+    Slot* slot = free_slots_.back();
+
+    T* object = new (&slot->storage) T(std::forward<Args>(args)...);
+
+    free_slots_.pop_back();
+    slot->alive = true;
+    ++size_;
+
+    return object;
+}
+
+template<typename T>
+inline void ObjectPool<T>::
+destroy(T* object) {
+    Slot* slot = reinterpret_cast<Slot*>(object);
+
+    object->~T();
+
+    slot->alive = false;
+    free_slots_.push_back(slot);
+    --size_;
+}
+
+}
+
+#endif /* defined(__mco__object_pool__) */
@@ -0,0 +1,135 @@
+//
+//  thread_pool.h
+//  mco
+//
+//
+
+#ifndef __mco__thread_pool__
+#define __mco__thread_pool__
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+
+namespace mco {
+
+/**
+ * Fixed number of worker threads working off a FIFO queue of tasks. Every
+ * task gets the index of the worker executing it, so that tasks can use
+ * per-worker data (e.g., solver workspaces) without further locking.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned number_of_threads
+                        = std::max(1u, std::thread::hardware_concurrency()));
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Finishes all submitted tasks before the workers are joined.
+     */
+    ~ThreadPool();
+
+    void submit(std::function<void(unsigned)> task);
+
+    /**
+     * Blocks until all submitted tasks are finished.
+     */
+    void wait();
+
+    unsigned size() const {
+        return workers_.size();
+    }
+
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void(unsigned)>> tasks_;
+
+    std::mutex mutex_;
+    std::condition_variable task_available_;
+    std::condition_variable tasks_finished_;
+
+    unsigned running_tasks_ = 0;
+    bool stopping_ = false;
+
+    inline void work(unsigned worker);
+};
+
+inline ThreadPool::
+ThreadPool(unsigned number_of_threads) {
+    for(unsigned i = 0; i < std::max(1u, number_of_threads); ++i) {
+        workers_.emplace_back(&ThreadPool::work, this, i);
+    }
+}
+
+inline ThreadPool::
+~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+
+    task_available_.notify_all();
+
+    for(auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+inline void ThreadPool::
+submit(std::function<void(unsigned)> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push(std::move(task));
+    }
+
+    task_available_.notify_one();
+}
+
+inline void ThreadPool::
+wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    tasks_finished_.wait(lock, [this] () {
+        return tasks_.empty() && running_tasks_ == 0;
+    });
+}
+
+inline void ThreadPool::
+work(unsigned worker) {
+    while(true) {
+        std::function<void(unsigned)> task;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_available_.wait(lock, [this] () {
+                return stopping_ || !tasks_.empty();
+            });
+
+            if(tasks_.empty()) {
+                return;
+            }
+
+            task = std::move(tasks_.front());
+            tasks_.pop();
+            ++running_tasks_;
+        }
+
+        task(worker);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --running_tasks_;
+        }
+
+        tasks_finished_.notify_all();
+    }
+}
+
+}
+
+#endif /* defined(__mco__thread_pool__) */
@@ -0,0 +1,85 @@
+//
+//  ep_label_bags.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_label_bags__
+#define __mco__ep_label_bags__
+
+#include <cstddef>
+#include <vector>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/point.h>
+
+namespace mco {
+
+/**
+ * Per-node bags of label costs which are only read for dominance checks,
+ * e.g., the costs of the permanent labels reclaimed by EpSolverMartins.
+ * The costs of a bag are stored contiguously, label after label.
+ */
+class EpLabelBags {
+public:
+    struct Bag {
+        const double* costs;
+        std::size_t size;
+    };
+
+    virtual ~EpLabelBags() { }
+
+    /**
+     * Empties all bags.
+     */
+    virtual void reset(const ogdf::Graph& graph, unsigned dimension) = 0;
+
+    virtual void add(ogdf::node n, const Point& cost) = 0;
+
+    /**
+     * The bag of n, valid until the next call to add.
+     */
+    virtual Bag bag(ogdf::node n) = 0;
+
+    /**
+     * Number of bytes of the bags held in memory.
+     */
+    virtual std::size_t resident_bytes() const = 0;
+};
+
+/**
+ * Keeps all bags in memory.
+ */
+class EpMemoryLabelBags : public EpLabelBags {
+public:
+    void reset(const ogdf::Graph& graph, unsigned dimension) override {
+        dimension_ = dimension;
+        values_ = 0;
+        bags_.assign(graph.maxNodeIndex() + 1, std::vector<double>());
+    }
+
+    void add(ogdf::node n, const Point& cost) override {
+        std::vector<double>& bag = bags_[n->index()];
+        bag.insert(bag.end(), cost.cbegin(), cost.cend());
+        values_ += dimension_;
+    }
+
+    Bag bag(ogdf::node n) override {
+        const std::vector<double>& bag = bags_[n->index()];
+        return Bag { bag.data(), bag.size() / dimension_ };
+    }
+
+    std::size_t resident_bytes() const override {
+        return values_ * sizeof(double);
+    }
+
+private:
+    unsigned dimension_ = 0;
+    std::size_t values_ = 0;
+    std::vector<std::vector<double>> bags_;
+};
+
+}
+
+#endif /* defined(__mco__ep_label_bags__) */
@@ -0,0 +1,98 @@
+//
+//  ep_mapped_label_bags.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_mapped_label_bags__
+#define __mco__ep_mapped_label_bags__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/point.h>
+#include <mco/ep/basic/ep_label_bags.h>
+
+namespace mco {
+
+/**
+ * Label bags which are spilled to a memory-mapped file once the bags in
+ * memory exceed a limit. The least recently used bags are spilled until
+ * half of the limit is reached. A spilled bag is one segment of doubles in
+ * the file and is read through the mapping, so that the operating system
+ * pages it in for dominance checks. Adding to a spilled bag moves it back
+ * into memory. The file is removed on destruction.
+ */
+class EpMappedLabelBags : public EpLabelBags {
+public:
+    EpMappedLabelBags(const std::string& file_name,
+                      std::size_t resident_limit);
+
+    ~EpMappedLabelBags();
+
+    EpMappedLabelBags(const EpMappedLabelBags&) = delete;
+    EpMappedLabelBags& operator=(const EpMappedLabelBags&) = delete;
+
+    void reset(const ogdf::Graph& graph, unsigned dimension) override;
+
+    void add(ogdf::node n, const Point& cost) override;
+
+    Bag bag(ogdf::node n) override;
+
+    std::size_t resident_bytes() const override {
+        return resident_values_ * sizeof(double);
+    }
+
+    /**
+     * Number of bytes of the spilled bags.
+     */
+    std::size_t spilled_bytes() const {
+        return (end_ - garbage_) * sizeof(double);
+    }
+
+    /**
+     * Number of times bags were spilled since the last reset.
+     */
+    unsigned spills() const {
+        return spills_;
+    }
+
+private:
+    static const std::size_t resident = static_cast<std::size_t>(-1);
+
+    const std::string file_name_;
+    const std::size_t resident_limit_;
+
+    int file_ = -1;
+    double* mapping_ = nullptr;
+
+    // In doubles
+    std::size_t capacity_ = 0;
+    std::size_t end_ = 0;
+    std::size_t garbage_ = 0;
+
+    unsigned dimension_ = 0;
+    std::size_t resident_values_ = 0;
+    unsigned spills_ = 0;
+
+    // [node index]
+    std::vector<std::vector<double>> resident_bags_;
+    std::vector<std::size_t> offsets_;
+    std::vector<std::size_t> spilled_values_;
+    std::vector<unsigned long> last_use_;
+    unsigned long clock_ = 0;
+
+    void spill();
+    void page_in(unsigned index);
+    void reserve(std::size_t values);
+    void compact();
+    void map(std::size_t capacity);
+    void unmap();
+};
+
+}
+
+#endif /* defined(__mco__ep_mapped_label_bags__) */
@@ -0,0 +1,75 @@
+//
+//  ep_boa_star.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_boa_star__
+#define __mco__ep_boa_star__
+
+#include <list>
+#include <functional>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/abstract_solver.h>
+
+namespace mco {
+
+/**
+ * Bi-objective A* (Hernández et al.: Simple and efficient bi-objective
+ * search algorithms via fast dominance checks). Labels are ordered
+ * lexicographically by their f-values g + h, where h are the exact
+ * distances to the target in each objective. In this order, a label is
+ * dominated iff its g_2 value is not smaller than the smallest g_2 value of
+ * an extracted label at the same node, or its f_2 value is not smaller
+ * than the one at the target. Both checks are done lazily in O(1) when a
+ * label is extracted, and before it is created.
+ */
+class EpSolverBOAStar : public AbstractSolver<std::list<ogdf::edge>> {
+public:
+    explicit EpSolverBOAStar(double epsilon = 0)
+    :   epsilon_(epsilon),
+        extracted_labels_(0),
+        created_labels_(0) { }
+
+    void Solve(const ogdf::Graph& graph,
+               std::function<const Point*(ogdf::edge)> weights,
+               ogdf::node source,
+               ogdf::node target,
+               bool directed = true);
+
+    unsigned extracted_labels() const {
+        return extracted_labels_;
+    }
+
+    unsigned created_labels() const {
+        return created_labels_;
+    }
+
+private:
+    const double epsilon_;
+
+    unsigned extracted_labels_;
+    unsigned created_labels_;
+
+    struct Label {
+        double g1;
+        double g2;
+        double f1;
+        double f2;
+        ogdf::node n;
+        ogdf::edge e;
+        const Label* pred;
+    };
+
+    struct FValueLexComp {
+        bool operator()(const Label* l1, const Label* l2) const {
+            return l1->f1 > l2->f1 || (l1->f1 == l2->f1 && l1->f2 > l2->f2);
+        }
+    };
+};
+
+}
+
+#endif /* defined(__mco__ep_boa_star__) */
@@ -9,6 +9,9 @@
 #ifndef BSSSA_H_
 #define BSSSA_H_
 
+#include <cstddef>
+#include <limits>
+
 #include <mco/basic/abstract_solver.h>
 
 namespace mco {
@@ -17,7 +20,10 @@ class EpSolverBS : public AbstractSolver<std::list<ogdf::edge>> {
     
 public:
 	EpSolverBS(double epsilon = 0)
-    : epsilon_(epsilon) { }
+    :   epsilon_(epsilon),
+        label_budget_(std::numeric_limits<std::size_t>::max()),
+        initial_tolerance_(1E-3),
+        achieved_epsilon_(0) { }
     
 	virtual void Solve(const ogdf::Graph& graph,
                        std::function<const Point*(const ogdf::edge)> costs,
@@ -26,8 +32,38 @@ public:
                        const ogdf::node target,
                        bool directed = true);
     
+    /**
+     * Limits the number of stored labels. Whenever the limit is exceeded,
+     * the search switches to approximate dominance and the labels of all
+     * nodes are merged. The relative tolerance of the frontier starts at
+     * initial_tolerance and doubles with every further excess. It is spread
+     * over the edges of the paths: a label is discarded if another label at
+     * its node is at most (1 + delta) times its cost in every objective,
+     * where the product of the (1 + delta) of all steps is the (n - 1)-th
+     * root of 1 + tolerance for n nodes.
+     */
+    void set_label_budget(std::size_t label_budget,
+                          double initial_tolerance = 1E-3) {
+        label_budget_ = label_budget;
+        initial_tolerance_ = initial_tolerance;
+    }
+    
+    /**
+     * 0 if the last call to Solve found the Pareto-frontier. Otherwise,
+     * every point of the Pareto-frontier is approximated by a solution
+     * whose cost is at most (1 + epsilon) times its cost in every
+     * objective, up to the epsilon of the comparisons.
+     */
+    double achieved_epsilon() const {
+        return achieved_epsilon_;
+    }
+    
 private:
     const double epsilon_;
+    
+    std::size_t label_budget_;
+    double initial_tolerance_;
+    double achieved_epsilon_;
 };
 
 }
@@ -9,15 +9,24 @@
 #ifndef _EP_WEIGHTED_BS_
 #define _EP_WEIGHTED_BS_
 
+#include <vector>
+
 #include <mco/basic/abstract_solver.h>
 
 namespace mco {
 
+/**
+ * Label correcting algorithm which only keeps the supported labels at every
+ * node. For two objectives, the supported labels are decided by an exact
+ * orientation predicate. For three or more objectives, they are decided up
+ * to hull_epsilon (see WeightSpaceSubdivision).
+ */
 class EpWeightedBS : public AbstractSolver<std::list<ogdf::edge>> {
     
 public:
-	EpWeightedBS(double epsilon = 0)
-    : epsilon_(epsilon) { }
+	EpWeightedBS(double epsilon = 0, double hull_epsilon = 1E-8)
+    :   epsilon_(epsilon),
+        hull_epsilon_(hull_epsilon) { }
     
 	virtual void Solve(const ogdf::Graph& graph,
                        std::function<const Point*(const ogdf::edge)> costs,
@@ -34,6 +43,11 @@ private:
                     double epsilon);
 
     const double epsilon_;
+    const double hull_epsilon_;
+    
+    // Reused between two calls of ConvexHull
+    std::vector<const Point *> merged_points_;
+    std::vector<unsigned> hull_indices_;
     
 };
 
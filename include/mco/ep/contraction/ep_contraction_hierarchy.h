@@ -0,0 +1,201 @@
+//
+//  ep_contraction_hierarchy.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_contraction_hierarchy__
+#define __mco__ep_contraction_hierarchy__
+
+#include <list>
+#include <vector>
+#include <map>
+#include <set>
+#include <string>
+#include <istream>
+#include <ostream>
+#include <functional>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/point.h>
+#include <mco/basic/abstract_solver.h>
+
+namespace mco {
+
+/**
+ * Multi-criteria contraction hierarchy. The nodes are contracted one by
+ * one; whenever a path u -> v -> w over the contracted node v is not
+ * (weakly) dominated by a witness path from u to w avoiding v, a shortcut
+ * u -> w is inserted. All shortcuts between the same pair of nodes form a
+ * Pareto-optimal bundle. Every efficient s-t-path then has an up-down
+ * counterpart in the hierarchy with the same (or a dominating) cost, cf.
+ * Funke, Storandt: Personalized route planning in road networks.
+ *
+ * Nodes are identified by their index in the graph. A hierarchy can be
+ * written to a stream and read back for the same graph, i.e., for a graph
+ * with the same node and edge indices.
+ */
+class EpContractionHierarchy {
+public:
+    explicit EpContractionHierarchy(double epsilon = 0,
+                                    unsigned witness_label_limit = 500)
+    :   epsilon_(epsilon),
+        witness_label_limit_(witness_label_limit) { }
+
+    void build(const ogdf::Graph& graph,
+               std::function<const Point*(ogdf::edge)> weights,
+               unsigned dimension,
+               bool directed = true);
+
+    void write(std::ostream& stream) const;
+
+    /**
+     * Reads a hierarchy which was built for graph. Returns false if the
+     * stream does not contain a hierarchy matching graph.
+     */
+    bool read(std::istream& stream, const ogdf::Graph& graph);
+
+    unsigned dimension() const {
+        return dimension_;
+    }
+
+    bool directed() const {
+        return directed_;
+    }
+
+    std::string statistics() const;
+
+private:
+    /**
+     * An entry of a bundle is either an original edge (edge >= 0) or the
+     * concatenation of the entries first and second over the node middle.
+     */
+    struct Entry {
+        Point cost;
+        int edge;
+        bool reversed;
+        unsigned middle;
+        unsigned first;
+        unsigned second;
+    };
+
+    struct Arc {
+        unsigned head;
+        std::vector<unsigned> entries;
+    };
+
+    struct WitnessLabel {
+        Point cost;
+        unsigned n;
+    };
+
+    const double epsilon_;
+    const unsigned witness_label_limit_;
+
+    unsigned dimension_ = 0;
+    bool directed_ = true;
+
+    std::vector<ogdf::node> nodes_;
+    std::vector<ogdf::edge> edges_;
+
+    std::vector<Entry> entries_;
+
+    // upward_arcs_[v] holds the arcs v -> w, downward_arcs_[v] the arcs
+    // w -> v for the nodes w contracted after v
+    std::vector<std::vector<Arc>> upward_arcs_;
+    std::vector<std::vector<Arc>> downward_arcs_;
+
+    // Remaining graph during the contraction
+    std::vector<std::map<unsigned, std::vector<unsigned>>> out_bundles_;
+    std::vector<std::set<unsigned>> in_neighbors_;
+
+    unsigned original_entries_ = 0;
+    unsigned witness_searches_ = 0;
+    unsigned exhausted_witness_searches_ = 0;
+
+    void index_graph(const ogdf::Graph& graph);
+
+    bool add_entry(unsigned tail, unsigned head, unsigned entry);
+
+    int priority(unsigned v, const std::vector<unsigned>& contracted_neighbors) const;
+
+    void contract(unsigned v);
+
+    void witness_search(unsigned source,
+                        unsigned excluded,
+                        const Point& bound,
+                        std::map<unsigned, std::vector<Point>>& witnesses);
+
+    void unpack(unsigned entry, std::list<ogdf::edge>& path) const;
+
+    friend class EpSolverContractionHierarchy;
+};
+
+/**
+ * Answers s-t-queries on a contraction hierarchy by a bidirectional
+ * upward Pareto label search. The backward search from the target is
+ * conducted first; the labels of the forward search are then combined
+ * with the backward labels at every meeting node and pruned by the
+ * frontier found so far. The result is the same frontier as
+ * EpSolverMartins computes on the original graph.
+ */
+class EpSolverContractionHierarchy : public AbstractSolver<std::list<ogdf::edge>> {
+public:
+    explicit EpSolverContractionHierarchy(const EpContractionHierarchy& hierarchy,
+                                          double epsilon = 0)
+    :   hierarchy_(hierarchy),
+        epsilon_(epsilon) { }
+
+    void Solve(ogdf::node source, ogdf::node target);
+
+    unsigned settled_labels() const {
+        return settled_labels_;
+    }
+
+private:
+    struct Label {
+        Point cost;
+        unsigned n;
+        int pred;
+        unsigned entry;
+    };
+
+    struct Candidate {
+        Point cost;
+        unsigned forward_label;
+        unsigned backward_label;
+    };
+
+    const EpContractionHierarchy& hierarchy_;
+    const double epsilon_;
+
+    unsigned settled_labels_ = 0;
+
+    std::vector<Label> forward_labels_;
+    std::vector<Label> backward_labels_;
+
+    std::vector<std::vector<unsigned>> forward_bags_;
+    std::vector<std::vector<unsigned>> backward_bags_;
+    std::vector<unsigned> touched_nodes_;
+
+    void upward_search(unsigned root,
+                       bool forward,
+                       std::list<Candidate>& frontier);
+
+    bool is_dominated(const Point& cost,
+                      const std::vector<unsigned>& bag,
+                      const std::vector<Label>& labels) const;
+
+    bool is_dominated(const Point& cost,
+                      const std::list<Candidate>& frontier) const;
+
+    void add_candidate(const Point& cost,
+                       unsigned forward_label,
+                       unsigned backward_label,
+                       std::list<Candidate>& frontier) const;
+};
+
+}
+
+#endif /* defined(__mco__ep_contraction_hierarchy__) */
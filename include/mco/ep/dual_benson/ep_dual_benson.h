@@ -9,6 +9,12 @@
 #ifndef __mco__ep_dual_benson__
 #define __mco__ep_dual_benson__
 
+#include <set>
+#include <list>
+#include <string>
+#include <mutex>
+#include <thread>
+#include <algorithm>
 #include <functional>
 
 #include <ogdf/basic/Graph.h>
@@ -17,6 +23,8 @@
 #include <mco/basic/abstract_solver.h>
 #include <mco/basic/weight_function_adaptors.h>
 #include <mco/generic/benson_dual/dual_benson_scalarizer.h>
+#include <mco/generic/benson_dual/dichotomic_scalarizer.h>
+#include <mco/generic/benson_dual/scalarization_cache.h>
 #include <mco/generic/benson_dual/ove_fp_v2.h>
 #include <mco/ep/basic/dijkstra.h>
 
@@ -24,22 +32,39 @@ namespace mco {
 
 class LexDijkstraSolverAdaptor {
 public:
+    using WeightedCallback = std::function<void(const Point&,
+                                                ogdf::NodeArray<Point*>&,
+                                                ogdf::NodeArray<ogdf::edge>&)>;
+    
+    /**
+     * callback is called once for every new point at the target,
+     * weighted_callback for every weighting (also if the point at the
+     * target is already known).
+     */
     LexDijkstraSolverAdaptor(const ogdf::Graph& graph,
                              std::function<const Point *(const ogdf::edge)> weights,
                              ogdf::node source,
                              ogdf::node target,
-                             std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback)
+                             std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback,
+                             WeightedCallback weighted_callback
+                             = [] (const Point&, ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&) {return;})
     :   graph_(graph),
         weights_(weights),
         source_(source),
         target_(target),
         callback_(callback),
+        weighted_callback_(weighted_callback),
         known_points_((LexPointComparator())) {}
     
     inline double operator()(const Point& weighting,
                              Point& value);
     
-    inline ~LexDijkstraSolverAdaptor();
+    /**
+     * callback is not called for point, e.g., since it was found before.
+     */
+    void add_known_point(const Point& point) {
+        known_points_.insert(point);
+    }
 
 private:
     LexDijkstra lex_dijkstra_solver_;
@@ -48,8 +73,9 @@ private:
     const ogdf::node source_;
     const ogdf::node target_;
     std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback_;
+    WeightedCallback weighted_callback_;
     
-    std::set<Point*, LexPointComparator> known_points_;
+    std::set<Point, LexPointComparator> known_points_;
     
 };
     
@@ -57,7 +83,8 @@ template<typename OnlineVertexEnumerator = GraphlessOVE>
 class EPDualBensonSolver : public AbstractSolver<std::list<ogdf::edge>> {
 public:
     EPDualBensonSolver(double epsilon = 1E-8)
-    :   epsilon_(epsilon) {}
+    :   epsilon_(epsilon),
+        weighted_callback_([] (const Point&, ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&) {return;}) {}
     
     void Solve(const ogdf::Graph& graph,
                std::function<Point const * (const ogdf::edge)> weight,
@@ -66,8 +93,112 @@ public:
                std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback
                = [] (ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&) {return;});
     
+    /**
+     * Same as Solve, but writes a checkpoint to checkpoint_file whenever
+     * interval seconds have passed. Needs an OnlineVertexEnumerator which
+     * supports checkpoints.
+     */
+    void Solve(const ogdf::Graph& graph,
+               std::function<Point const * (const ogdf::edge)> weight,
+               const ogdf::node source,
+               const ogdf::node target,
+               const std::string& checkpoint_file,
+               double interval,
+               std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback
+               = [] (ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&) {return;});
+    
+    /**
+     * Continues a Solve from checkpoint_file. callback is not called again
+     * for the points found before the checkpoint.
+     */
+    void Resume(const ogdf::Graph& graph,
+                std::function<Point const * (const ogdf::edge)> weight,
+                const ogdf::node source,
+                const ogdf::node target,
+                const std::string& checkpoint_file,
+                double interval,
+                std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback
+                = [] (ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&) {return;});
+    
+    /**
+     * Receives the weighting and the distance tree of every scalarization,
+     * i.e., also those scalarizations yielding an already known point.
+     * Disables the ScalarizationCache, which would skip some of them.
+     */
+    void set_weighted_callback(LexDijkstraSolverAdaptor::WeightedCallback callback) {
+        weighted_callback_ = callback;
+        scalarization_cache_ = false;
+    }
+    
+    /**
+     * Scalarizations which are answered by a known path without Dijkstra,
+     * see ScalarizationCache. Enabled by default.
+     */
+    void set_scalarization_cache(bool scalarization_cache) {
+        scalarization_cache_ = scalarization_cache;
+    }
+    
+    /**
+     * See DualBensonScalarizer::set_approximation_tolerance.
+     */
+    void set_approximation_tolerance(double tolerance) {
+        approximation_tolerance_ = tolerance;
+    }
+    
+    /**
+     * Approximation error of the last Solve, see
+     * DualBensonScalarizer::approximation_error.
+     */
+    double approximation_error() const {
+        return approximation_error_;
+    }
+    
 private:
     double epsilon_;
+    LexDijkstraSolverAdaptor::WeightedCallback weighted_callback_;
+    
+    double approximation_tolerance_ = 0;
+    double approximation_error_ = 0;
+    
+    bool scalarization_cache_ = true;
+    
+    template<typename Calculate>
+    void solve(const ogdf::Graph& graph,
+               std::function<Point const * (const ogdf::edge)> weight,
+               const ogdf::node source,
+               const ogdf::node target,
+               std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback,
+               const std::list<Point>& known_points,
+               Calculate calculate);
+    
+};
+    
+/**
+ * Same extreme points as EPDualBensonSolver for two objectives, where the
+ * scalarizations are solved in parallel by the dichotomic scheme.
+ */
+class EPDichotomicSolver : public AbstractSolver<std::list<ogdf::edge>> {
+public:
+    EPDichotomicSolver(double epsilon = 1E-8,
+                       unsigned number_of_threads
+                       = std::max(1u, std::thread::hardware_concurrency()))
+    :   epsilon_(epsilon),
+        number_of_threads_(number_of_threads) {}
+    
+    /**
+     * callback is called once for every new point at the target, never
+     * concurrently.
+     */
+    inline void Solve(const ogdf::Graph& graph,
+                      std::function<Point const * (const ogdf::edge)> weight,
+                      const ogdf::node source,
+                      const ogdf::node target,
+                      std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback
+                      = [] (ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&) {return;});
+    
+private:
+    double epsilon_;
+    unsigned number_of_threads_;
     
 };
     
@@ -97,11 +228,12 @@ operator()(const Point& weighting,
         value[i] = target_cost[i + 1];
     }
     
-    if(known_points_.count(&value) == 0) {
+    if(known_points_.insert(value).second) {
         callback_(distance, predecessor);
-        known_points_.insert(new Point(value));
     }
     
+    weighted_callback_(weighting, distance, predecessor);
+    
     
     double weighted_value = target_cost[0];
     
@@ -112,39 +244,154 @@ operator()(const Point& weighting,
     return weighted_value;
 }
     
-LexDijkstraSolverAdaptor::~LexDijkstraSolverAdaptor() {
-    for(auto point : known_points_) {
-        delete point;
-    }
+template<typename OnlineVertexEnumerator>
+inline void EPDualBensonSolver<OnlineVertexEnumerator>::
+Solve(const ogdf::Graph& graph,
+      std::function<Point const *(const ogdf::edge)> weights,
+      ogdf::node source,
+      ogdf::node target,
+      std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback) {
+    
+    solve(graph, weights, source, target, callback, {},
+          [] (DualBensonScalarizer<OnlineVertexEnumerator>& dual_benson_solver,
+              std::list<Point *>& frontier) {
+              dual_benson_solver.Calculate_solutions(frontier);
+          });
 }
- 
+    
 template<typename OnlineVertexEnumerator>
 inline void EPDualBensonSolver<OnlineVertexEnumerator>::
 Solve(const ogdf::Graph& graph,
       std::function<Point const *(const ogdf::edge)> weights,
       ogdf::node source,
       ogdf::node target,
+      const std::string& checkpoint_file,
+      double interval,
       std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback) {
     
+    solve(graph, weights, source, target, callback, {},
+          [&] (DualBensonScalarizer<OnlineVertexEnumerator>& dual_benson_solver,
+               std::list<Point *>& frontier) {
+              dual_benson_solver.Calculate_solutions(frontier, checkpoint_file, interval);
+          });
+}
+    
+template<typename OnlineVertexEnumerator>
+inline void EPDualBensonSolver<OnlineVertexEnumerator>::
+Resume(const ogdf::Graph& graph,
+       std::function<Point const *(const ogdf::edge)> weights,
+       ogdf::node source,
+       ogdf::node target,
+       const std::string& checkpoint_file,
+       double interval,
+       std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback) {
+    
+    auto known_points = DualBensonScalarizer<OnlineVertexEnumerator>::checkpoint_solutions(checkpoint_file);
+    
+    solve(graph, weights, source, target, callback, known_points,
+          [&] (DualBensonScalarizer<OnlineVertexEnumerator>& dual_benson_solver,
+               std::list<Point *>& frontier) {
+              dual_benson_solver.Resume_solutions(frontier, checkpoint_file, interval);
+          });
+}
+    
+template<typename OnlineVertexEnumerator>
+template<typename Calculate>
+inline void EPDualBensonSolver<OnlineVertexEnumerator>::
+solve(const ogdf::Graph& graph,
+      std::function<Point const *(const ogdf::edge)> weights,
+      ogdf::node source,
+      ogdf::node target,
+      std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback,
+      const std::list<Point>& known_points,
+      Calculate calculate) {
+    
     std::list<Point *> frontier;
     
+    LexDijkstraSolverAdaptor adaptor(graph, weights, source, target, callback, weighted_callback_);
+    for(auto& point : known_points) {
+        adaptor.add_known_point(point);
+    }
+    
+    std::function<double(const Point&, Point&)> solver = adaptor;
+    
+    if(scalarization_cache_) {
+        solver = ScalarizationCache(solver, epsilon_);
+    }
+    
     DualBensonScalarizer<OnlineVertexEnumerator>
-    dual_benson_solver(LexDijkstraSolverAdaptor(graph, weights, source, target, callback),
+    dual_benson_solver(solver,
                        weights(graph.chooseEdge())->dimension(),
                        epsilon_);
     
-    dual_benson_solver.Calculate_solutions(frontier);
+    dual_benson_solver.set_approximation_tolerance(approximation_tolerance_);
+    
+    calculate(dual_benson_solver, frontier);
+    
+    approximation_error_ = dual_benson_solver.approximation_error();
     
-    std::list<std::pair<std::list<edge>, Point>> solutions;
+    std::list<std::pair<std::list<ogdf::edge>, Point>> solutions;
     
     for(auto point : frontier) {
-        solutions.push_back(make_pair(std::list<edge>(), *point));
+        solutions.push_back(std::make_pair(std::list<ogdf::edge>(), *point));
     }
                             
     add_solutions(solutions.begin(), solutions.end());
     
 }
     
+inline void EPDichotomicSolver::
+Solve(const ogdf::Graph& graph,
+      std::function<Point const *(const ogdf::edge)> weights,
+      ogdf::node source,
+      ogdf::node target,
+      std::function<void(ogdf::NodeArray<Point*>&, ogdf::NodeArray<ogdf::edge>&)> callback) {
+    
+    std::mutex callback_mutex;
+    std::set<Point, LexPointComparator> known_points;
+    
+    // Every worker has its own adaptor, such that the same point may be
+    // found by several workers
+    auto synchronized_callback = [&] (ogdf::NodeArray<Point*>& distance,
+                                      ogdf::NodeArray<ogdf::edge>& predecessor) {
+        
+        const Point& target_cost = *distance[target];
+        Point value(target_cost.dimension() - 1);
+        for(unsigned i = 0; i < value.dimension(); ++i) {
+            value[i] = target_cost[i + 1];
+        }
+        
+        std::lock_guard<std::mutex> lock(callback_mutex);
+        if(known_points.insert(value).second) {
+            callback(distance, predecessor);
+        }
+    };
+    
+    std::list<Point *> frontier;
+    
+    DichotomicScalarizer dichotomic_solver([&] () {
+                                               return LexDijkstraSolverAdaptor(graph,
+                                                                               weights,
+                                                                               source,
+                                                                               target,
+                                                                               synchronized_callback);
+                                           },
+                                           epsilon_,
+                                           number_of_threads_);
+    
+    dichotomic_solver.Calculate_solutions(frontier);
+    
+    std::list<std::pair<std::list<ogdf::edge>, Point>> solutions;
+    
+    for(auto point : frontier) {
+        solutions.push_back(make_pair(std::list<ogdf::edge>(), *point));
+        delete point;
+    }
+    
+    add_solutions(solutions.begin(), solutions.end());
+    
+}
+    
 }
 
 #endif /* defined(__mco__ep_dual_benson__) */
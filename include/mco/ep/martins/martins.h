@@ -10,19 +10,38 @@
 #ifndef MARTINS_B_H_
 #define MARTINS_B_H_
 
+#include <cstddef>
+#include <limits>
+
 #include <mco/basic/abstract_solver.h>
+#include <mco/ep/basic/ep_label_bags.h>
+#include <mco/ep/preprocessing/ep_lower_bound_sets.h>
 
 namespace mco {
 
 class EpSolverMartins : public AbstractSolver<std::list<ogdf::edge>> {
 
 public:
+    using DistanceTree = std::pair<ogdf::NodeArray<Point*>, ogdf::NodeArray<ogdf::edge>>;
+    
 	explicit EpSolverMartins(double epsilon = 0)
     :   epsilon_(epsilon),
         do_value_callback_(false),
         value_callback_([] (Point) {return;}),
         do_path_callback_(false),
-        path_callback_([] (std::list<ogdf::node>) {return;}) { }
+        path_callback_([] (std::list<ogdf::node>) {return;}),
+        verbose_(true),
+        lower_bound_sets_(nullptr),
+        label_bags_(nullptr),
+        tree_stream_([] (DistanceTree&) { return false; }),
+        max_queue_size_(0),
+        reclaimed_labels_(0),
+        peak_label_memory_(0),
+        final_label_memory_(0),
+        label_budget_(std::numeric_limits<std::size_t>::max()),
+        initial_tolerance_(1E-3),
+        achieved_epsilon_(0),
+        beam_width_(0) { }
     
     void Solve(ogdf::Graph& graph,
                std::function<const Point*(ogdf::edge)> weights,
@@ -103,6 +122,112 @@ public:
         do_path_callback_ = true;
     }
     
+    /**
+     * Prints the number of deleted labels after solving if set (default).
+     */
+    void set_verbose(bool verbose) {
+        verbose_ = verbose;
+    }
+    
+    /**
+     * Maximum number of labels in the queue during the last call to Solve.
+     */
+    unsigned max_queue_size() const {
+        return max_queue_size_;
+    }
+    
+    /**
+     * Number of labels freed during the last call to Solve because none of
+     * their extensions was still alive. Only their costs are kept to check
+     * dominance at their nodes.
+     */
+    unsigned reclaimed_labels() const {
+        return reclaimed_labels_;
+    }
+    
+    /**
+     * Maximum number of bytes used by labels and by the costs of reclaimed
+     * labels during the last call to Solve.
+     */
+    std::size_t peak_label_memory() const {
+        return peak_label_memory_;
+    }
+    
+    /**
+     * Number of bytes used by labels and by the costs of reclaimed labels
+     * at the end of the last call to Solve.
+     */
+    std::size_t final_label_memory() const {
+        return final_label_memory_;
+    }
+    
+    /**
+     * Discards labels whose lower bound sets cannot reach the search region
+     * of the labels at the target. The sets have to be computed for the
+     * target of the next calls to Solve. Set nullptr to disable.
+     */
+    void set_lower_bound_sets(const EpLowerBoundSets* lower_bound_sets) {
+        lower_bound_sets_ = lower_bound_sets;
+    }
+    
+    /**
+     * Polled before every label is processed, e.g., to receive the trees of
+     * a concurrently running first phase. Every tree rooted at the source
+     * seeds labels along its paths which are not dominated yet. Its label at
+     * the target also tightens the upper bounds used with lower bound sets.
+     * The distance points are deleted after seeding.
+     */
+    void set_tree_stream(std::function<bool(DistanceTree&)> stream) {
+        tree_stream_ = stream;
+    }
+    
+    /**
+     * Stores the costs of reclaimed labels in the given bags, e.g., to spill
+     * them to a file. They are kept in memory if set to nullptr (default).
+     */
+    void set_label_bags(EpLabelBags* label_bags) {
+        label_bags_ = label_bags;
+    }
+    
+    /**
+     * Limits the number of stored labels. Whenever the limit is exceeded,
+     * the search switches to approximate dominance and the queued labels
+     * of all nodes are merged. The relative tolerance of the frontier
+     * starts at initial_tolerance and doubles with every further excess.
+     * It is spread over the edges of the paths: a label is discarded if
+     * another label at its node is at most (1 + delta) times its cost in
+     * every objective, where the product of the (1 + delta) of all steps is
+     * the (n - 1)-th root of 1 + tolerance for n nodes.
+     */
+    void set_label_budget(std::size_t label_budget,
+                          double initial_tolerance = 1E-3) {
+        label_budget_ = label_budget;
+        initial_tolerance_ = initial_tolerance;
+    }
+    
+    /**
+     * Beam search for quick answers: every node keeps at most beam_width
+     * labels, and the labels are expanded in lexicographic order of their
+     * costs plus the heuristic. If a node holds too many labels, the queued
+     * label with the smallest crowding distance is removed, so that the kept
+     * labels spread over the frontier. Queued labels which are already
+     * predecessors, e.g., seeded by a tree stream, are never removed, so
+     * that such nodes may hold more labels. 0 (default) solves exactly.
+     */
+    void set_beam_width(unsigned beam_width) {
+        beam_width_ = beam_width;
+    }
+    
+    /**
+     * 0 if the label budget was kept in the last call to Solve. Otherwise,
+     * every point of the Pareto-frontier is approximated by a solution
+     * whose cost is at most (1 + epsilon) times its cost in every
+     * objective, up to the epsilon of the comparisons.
+     */
+    double achieved_epsilon() const {
+        return achieved_epsilon_;
+    }
+    
 private:
     const double epsilon_;
     
@@ -110,6 +235,18 @@ private:
     std::function<void(Point)> value_callback_;
     bool do_path_callback_;
     std::function<void(std::list<ogdf::node>)> path_callback_;
+    bool verbose_;
+    const EpLowerBoundSets* lower_bound_sets_;
+    EpLabelBags* label_bags_;
+    std::function<bool(DistanceTree&)> tree_stream_;
+    unsigned max_queue_size_;
+    unsigned reclaimed_labels_;
+    std::size_t peak_label_memory_;
+    std::size_t final_label_memory_;
+    std::size_t label_budget_;
+    double initial_tolerance_;
+    double achieved_epsilon_;
+    unsigned beam_width_;
     
     void Solve(ogdf::Graph& graph,
                std::function<const Point*(ogdf::edge)> weights,
@@ -130,6 +267,10 @@ private:
         bool mark_dominated;
         bool in_queue;
         
+        // Number of labels having this label as predecessor, plus pins
+        // while the label is extended or used to seed a tree
+        mutable unsigned successors;
+        
         inline Label(const Point *point, ogdf::node n, const Label *pred);
         inline Label(const Label &label);
         
@@ -194,7 +335,12 @@ Label(const Point *point,
     n(n),
     pred(pred),
     mark_dominated(false),
-    in_queue(true) {
+    in_queue(true),
+    successors(0) {
+    
+    if(pred != nullptr) {
+        ++pred->successors;
+    }
 }
 
 EpSolverMartins::Label::
@@ -203,7 +349,12 @@ Label(const Label &label)
     n(label.n),
     pred(label.pred),
     mark_dominated(label.mark_dominated),
-    in_queue(label.in_queue) {
+    in_queue(label.in_queue),
+    successors(0) {
+    
+    if(pred != nullptr) {
+        ++pred->successors;
+    }
 }
 
 }
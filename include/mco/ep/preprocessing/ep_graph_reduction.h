@@ -0,0 +1,119 @@
+//
+//  ep_graph_reduction.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_graph_reduction__
+#define __mco__ep_graph_reduction__
+
+#include <list>
+#include <vector>
+#include <string>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/point.h>
+
+namespace mco {
+
+/**
+ * Builds a reduced copy of an EP instance which has the same set of
+ * efficient s-t-paths (within the given bound). The reduction
+ *  - removes nodes which are not on any s-t-path,
+ *  - removes nodes whose ideal point (lower bound on the distance from the
+ *    source plus lower bound on the distance to the target) exceeds the
+ *    bound in some objective,
+ *  - removes parallel edges whose costs are dominated,
+ *  - contracts chains of degree-2 nodes into single edges.
+ * Paths in the reduced graph can be mapped back to the original graph.
+ */
+class EpGraphReduction {
+public:
+    explicit EpGraphReduction(double epsilon = 0)
+    :   epsilon_(epsilon) { }
+
+    /**
+     * source_distances[i][v] and target_distances[i][v] have to be lower
+     * bounds on the distance from source to v and from v to target in
+     * objective i, respectively, e.g., Dijkstra distances. If they are
+     * empty, no node is removed because of the bound.
+     */
+    void reduce(const ogdf::Graph& graph,
+                const ogdf::EdgeArray<Point>& costs,
+                unsigned dimension,
+                ogdf::node source,
+                ogdf::node target,
+                const std::vector<ogdf::NodeArray<double>>& source_distances,
+                const std::vector<ogdf::NodeArray<double>>& target_distances,
+                const Point& bound,
+                bool directed = true);
+
+    ogdf::Graph& graph() {
+        return reduced_graph_;
+    }
+
+    ogdf::EdgeArray<Point>& costs() {
+        return reduced_costs_;
+    }
+
+    ogdf::node source() const {
+        return source_;
+    }
+
+    ogdf::node target() const {
+        return target_;
+    }
+
+    ogdf::node original_node(ogdf::node n) const {
+        return original_node_[n];
+    }
+
+    const std::list<ogdf::edge>& original_edges(ogdf::edge e) const {
+        return original_edges_[e];
+    }
+
+    /**
+     * Maps a source-target-path of the reduced graph to a path of the
+     * original graph.
+     */
+    std::list<ogdf::edge> original_path(const std::list<ogdf::edge>& path) const;
+
+    std::string statistics() const;
+
+private:
+    double epsilon_;
+    bool directed_;
+
+    ogdf::Graph reduced_graph_;
+    ogdf::NodeArray<ogdf::node> original_node_;
+    ogdf::EdgeArray<Point> reduced_costs_;
+    ogdf::EdgeArray<std::list<ogdf::edge>> original_edges_;
+
+    ogdf::node source_;
+    ogdf::node target_;
+
+    unsigned original_nodes_ = 0;
+    unsigned original_edges_count_ = 0;
+    unsigned unreachable_nodes_ = 0;
+    unsigned bounded_nodes_ = 0;
+    unsigned dead_end_nodes_ = 0;
+    unsigned dominated_edges_ = 0;
+    unsigned contracted_nodes_ = 0;
+
+    void reachable_nodes(ogdf::node root,
+                         bool forward,
+                         ogdf::NodeArray<bool>& reached) const;
+
+    bool remove_dominated_parallel_edges(ogdf::node n, ogdf::node neighbor);
+
+    bool is_dead_end(ogdf::node n) const;
+
+    bool contract(ogdf::node n, std::list<ogdf::node>& touched_nodes);
+
+    void append_edges(ogdf::edge e, ogdf::node from, std::list<ogdf::edge>& path) const;
+};
+
+}
+
+#endif /* defined(__mco__ep_graph_reduction__) */
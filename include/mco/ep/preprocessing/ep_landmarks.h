@@ -0,0 +1,142 @@
+//
+//  ep_landmarks.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_landmarks__
+#define __mco__ep_landmarks__
+
+#include <vector>
+#include <functional>
+#include <cmath>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/point.h>
+
+namespace mco {
+
+/**
+ * Landmark (ALT) lower bounds for all objectives. For k landmarks L chosen
+ * by farthest-point selection, the distances d(L, v) (and d(v, L) for
+ * directed graphs) are stored per objective contiguously for every node.
+ * By the triangle inequality,
+ *  d(v, t) >= |d(L, t) - d(L, v)| (undirected),
+ *  d(v, t) >= max(d(L, t) - d(L, v), d(v, L) - d(t, L)) (directed),
+ * which gives a lower bound for every pair of nodes in O(k) time.
+ */
+class EpLandmarks {
+public:
+    explicit EpLandmarks(unsigned number_of_landmarks = 8)
+    :   number_of_landmarks_(number_of_landmarks) { }
+
+    void compute(const ogdf::Graph& graph,
+                 std::function<const Point*(ogdf::edge)> weights,
+                 unsigned dimension,
+                 bool directed = false);
+
+    /**
+     * Lower bound on the distance from n to target in the given objective.
+     */
+    inline double lower_bound(ogdf::node n,
+                              ogdf::node target,
+                              unsigned objective) const;
+
+    /**
+     * Returns lower bounds on the distances to target which can be used
+     * as heuristic for EpSolverMartins. The values of target are copied
+     * so that each call only has to look up the values of n.
+     */
+    std::function<double(ogdf::node, unsigned)> heuristic(ogdf::node target) const;
+
+    const std::vector<ogdf::node>& landmarks() const {
+        return landmarks_;
+    }
+
+private:
+    const unsigned number_of_landmarks_;
+
+    unsigned dimension_ = 0;
+    bool directed_ = false;
+
+    std::vector<ogdf::node> landmarks_;
+
+    // [node index][landmark][objective]
+    std::vector<double> distances_from_landmarks_;
+    std::vector<double> distances_to_landmarks_;
+
+    inline double lower_bound(const double* from_n,
+                              const double* to_n,
+                              const double* from_target,
+                              const double* to_target,
+                              unsigned objective) const;
+
+    void landmark_distances(const ogdf::Graph& graph,
+                            std::function<const Point*(ogdf::edge)> weights,
+                            ogdf::node landmark,
+                            unsigned landmark_index,
+                            bool to_landmark);
+};
+
+inline double EpLandmarks::
+lower_bound(ogdf::node n,
+            ogdf::node target,
+            unsigned objective) const {
+
+    if(landmarks_.empty()) {
+        return 0;
+    }
+
+    unsigned stride = landmarks_.size() * dimension_;
+
+    const double* to_n = nullptr;
+    const double* to_target = nullptr;
+
+    if(directed_) {
+        to_n = &distances_to_landmarks_[n->index() * stride];
+        to_target = &distances_to_landmarks_[target->index() * stride];
+    }
+
+    return lower_bound(&distances_from_landmarks_[n->index() * stride],
+                       to_n,
+                       &distances_from_landmarks_[target->index() * stride],
+                       to_target,
+                       objective);
+}
+
+inline double EpLandmarks::
+lower_bound(const double* from_n,
+            const double* to_n,
+            const double* from_target,
+            const double* to_target,
+            unsigned objective) const {
+
+    // Differences of infinite distances are NaN and never
+    // increase the bound
+    double bound = 0;
+
+    for(unsigned i = objective; i < landmarks_.size() * dimension_; i += dimension_) {
+        double difference = from_target[i] - from_n[i];
+
+        if(directed_) {
+            if(difference > bound) {
+                bound = difference;
+            }
+
+            difference = to_n[i] - to_target[i];
+        } else {
+            difference = std::abs(difference);
+        }
+
+        if(difference > bound) {
+            bound = difference;
+        }
+    }
+
+    return bound;
+}
+
+}
+
+#endif /* defined(__mco__ep_landmarks__) */
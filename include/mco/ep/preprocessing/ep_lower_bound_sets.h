@@ -0,0 +1,133 @@
+//
+//  ep_lower_bound_sets.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_lower_bound_sets__
+#define __mco__ep_lower_bound_sets__
+
+#include <vector>
+#include <functional>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/point.h>
+#include <mco/basic/local_upper_bounds.h>
+
+namespace mco {
+
+/**
+ * Convex lower bound sets on the costs of the paths from every node to
+ * the target. The dual Benson first phase is rooted at the target; each
+ * of its scalarizations with weighting w_k gives a distance tree, i.e.,
+ * the hyperplane w_k * y >= D_k(v) for every node v. The weightings are
+ * shared by all nodes, so only the right hand sides D_k(v) are stored per
+ * node. The unit weightings give the ideal point of every node.
+ *
+ * Like the first phase, the distance trees are computed on the undirected
+ * graph, which still gives lower bounds for directed instances.
+ */
+class EpLowerBoundSets {
+public:
+    explicit EpLowerBoundSets(double epsilon = 1E-8)
+    :   epsilon_(epsilon) { }
+
+    void compute(const ogdf::Graph& graph,
+                 std::function<const Point*(ogdf::edge)> weights,
+                 ogdf::node source,
+                 ogdf::node target);
+
+    /**
+     * Returns whether a path to the target starting with a label of the
+     * given cost at node n can reach the search region of the local upper
+     * bounds, i.e., whether label + lower bound set of n intersects some
+     * { y : y < u }. This holds iff
+     *  cost_i + ideal_i(n) < u_i for all objectives i and
+     *  w_k * cost + D_k(n) < w_k * u for all weightings w_k.
+     */
+    inline bool may_improve(ogdf::node n,
+                            const Point& cost,
+                            const LocalUpperBounds& upper_bounds) const;
+
+    unsigned number_of_hyperplanes() const {
+        return weightings_.size();
+    }
+
+private:
+    const double epsilon_;
+
+    unsigned dimension_ = 0;
+
+    std::vector<Point> weightings_;
+
+    // [node index][weighting] and [node index][objective]
+    std::vector<double> right_hand_sides_;
+    std::vector<double> ideal_points_;
+
+    inline static double weighted_bound(const Point& weighting, const Point& bound);
+};
+
+inline double EpLowerBoundSets::
+weighted_bound(const Point& weighting, const Point& bound) {
+    // Avoids 0 * infinity for unbounded objectives
+    double value = 0;
+    for(unsigned i = 0; i < weighting.dimension(); ++i) {
+        if(weighting[i] != 0) {
+            value += weighting[i] * bound[i];
+        }
+    }
+    return value;
+}
+
+inline bool EpLowerBoundSets::
+may_improve(ogdf::node n,
+            const Point& cost,
+            const LocalUpperBounds& upper_bounds) const {
+
+    unsigned number_of_weightings = weightings_.size();
+
+    const double* right_hand_sides = &right_hand_sides_[n->index() * number_of_weightings];
+    const double* ideal_point = &ideal_points_[n->index() * dimension_];
+
+    // The ideal point test is cheaper and filters most of the bounds
+    std::vector<const Point*> candidates;
+    for(auto& bound : upper_bounds.bounds()) {
+        bool intersects = true;
+
+        for(unsigned i = 0; i < dimension_ && intersects; ++i) {
+            intersects = cost[i] + ideal_point[i] < bound[i] + epsilon_;
+        }
+
+        if(intersects) {
+            candidates.push_back(&bound);
+        }
+    }
+
+    if(candidates.empty()) {
+        return false;
+    }
+
+    std::vector<double> lower_bounds(number_of_weightings);
+    for(unsigned k = 0; k < number_of_weightings; ++k) {
+        lower_bounds[k] = weightings_[k] * cost + right_hand_sides[k];
+    }
+
+    for(auto bound : candidates) {
+        bool intersects = true;
+
+        for(unsigned k = 0; k < number_of_weightings && intersects; ++k) {
+            intersects = lower_bounds[k] < weighted_bound(weightings_[k], *bound) + epsilon_;
+        }
+
+        if(intersects) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+}
+
+#endif /* defined(__mco__ep_lower_bound_sets__) */
@@ -0,0 +1,76 @@
+//
+//  ep_query_server.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_query_server__
+#define __mco__ep_query_server__
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <istream>
+#include <ostream>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/point.h>
+#include <mco/basic/thread_pool.h>
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/preprocessing/ep_landmarks.h>
+#include <mco/ep/contraction/ep_contraction_hierarchy.h>
+
+namespace mco {
+
+/**
+ * Answers efficient path queries "source target [bound_1 ... bound_d]" on
+ * one instance, where nodes are given by their index. Bounded queries are
+ * solved by Martins' algorithm with the landmark heuristic, unbounded
+ * queries by the contraction hierarchy if there is one. The graph, the
+ * landmarks and the hierarchy are shared read-only; every worker of the
+ * pool has its own solvers.
+ */
+class EpQueryServer {
+public:
+    EpQueryServer(ogdf::Graph& graph,
+                  const ogdf::EdgeArray<Point>& costs,
+                  unsigned dimension,
+                  bool directed,
+                  double epsilon,
+                  const EpLandmarks& landmarks,
+                  const EpContractionHierarchy* hierarchy,
+                  unsigned number_of_workers);
+
+    /**
+     * Returns "<n> points" followed by one line per point, or a line
+     * starting with "error:" for a malformed query.
+     */
+    std::string answer(const std::string& query, unsigned worker);
+
+    /**
+     * Answers the queries of input line by line on pool, which must not
+     * have more workers than this server. Every response is prefixed by
+     * "query <id>: ", where id is the number of the query in input, since
+     * the responses are written in the order in which they are finished.
+     * Empty lines and lines starting with '#' are skipped.
+     */
+    void serve_stream(std::istream& input, std::ostream& output, ThreadPool& pool);
+
+private:
+    ogdf::Graph& graph_;
+    const ogdf::EdgeArray<Point>& costs_;
+    unsigned dimension_;
+    bool directed_;
+
+    const EpLandmarks& landmarks_;
+
+    std::vector<ogdf::node> nodes_;
+
+    std::vector<std::unique_ptr<EpSolverMartins>> martins_solvers_;
+    std::vector<std::unique_ptr<EpSolverContractionHierarchy>> hierarchy_solvers_;
+};
+
+}
+
+#endif /* defined(__mco__ep_query_server__) */
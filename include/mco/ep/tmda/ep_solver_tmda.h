@@ -0,0 +1,94 @@
+//
+//  ep_solver_tmda.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_solver_tmda__
+#define __mco__ep_solver_tmda__
+
+#include <list>
+#include <functional>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/abstract_solver.h>
+#include <mco/basic/lex_point_comparator.h>
+
+namespace mco {
+
+/**
+ * Targeted multiobjective Dijkstra algorithm (Maristany de las Casas,
+ * Sedeño-Noda, Borndörfer: An improved multiobjective shortest path
+ * algorithm). The heap holds at most one tentative label per node, the
+ * lexicographically smallest one which is not dominated by the permanent
+ * labels of the node or of the target. Whenever the label of a node becomes
+ * permanent, the next tentative label of the node is generated lazily from
+ * the permanent labels of its predecessors: per incoming arc, an index
+ * points to the first permanent label of the tail which has not been
+ * dominated yet. Apart from the permanent labels, memory is therefore
+ * linear in the size of the graph.
+ */
+class EpSolverTMDA : public AbstractSolver<std::list<ogdf::edge>> {
+public:
+    explicit EpSolverTMDA(double epsilon = 0)
+    :   epsilon_(epsilon),
+        max_queue_size_(0),
+        max_stored_labels_(0),
+        created_labels_(0) { }
+
+    void Solve(const ogdf::Graph& graph,
+               std::function<const Point*(ogdf::edge)> weights,
+               unsigned dimension,
+               ogdf::node source,
+               ogdf::node target,
+               bool directed = true);
+
+    unsigned max_queue_size() const {
+        return max_queue_size_;
+    }
+
+    /**
+     * Maximum number of permanent and tentative labels at the same time.
+     */
+    unsigned max_stored_labels() const {
+        return max_stored_labels_;
+    }
+
+    unsigned created_labels() const {
+        return created_labels_;
+    }
+
+private:
+    const double epsilon_;
+
+    unsigned max_queue_size_;
+    unsigned max_stored_labels_;
+    unsigned created_labels_;
+
+    struct Label {
+        const Point cost;
+        const ogdf::node n;
+        const ogdf::edge e;
+        const Label * const pred;
+
+        Label(Point cost, ogdf::node n, ogdf::edge e, const Label *pred)
+        :   cost(std::move(cost)), n(n), e(e), pred(pred) { }
+    };
+
+    // There is at most one label per node in the heap
+    struct LabelLexComp {
+        bool operator()(const Label* l1, const Label* l2) const {
+            if(LexPointComparator()(l1->cost, l2->cost)) {
+                return true;
+            } else if(LexPointComparator()(l2->cost, l1->cost)) {
+                return false;
+            }
+            return l1->n->index() < l2->n->index();
+        }
+    };
+};
+
+}
+
+#endif /* defined(__mco__ep_solver_tmda__) */
@@ -0,0 +1,61 @@
+//
+//  ep_two_phase.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_two_phase__
+#define __mco__ep_two_phase__
+
+#include <list>
+#include <thread>
+#include <algorithm>
+#include <functional>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/abstract_solver.h>
+
+namespace mco {
+
+/**
+ * Two phase method for bi-objective efficient path problems. The first
+ * phase finds the extreme supported points by the dual Benson algorithm.
+ * Sorted by the first objective, two consecutive extreme points p and q
+ * span the triangle with corners p, q and (q_1, p_2), which contains all
+ * other non-dominated points between them. The second phase runs one
+ * bounded Martins search per triangle in parallel and merges the partial
+ * frontiers.
+ *
+ * The first phase is computed on the undirected graph. Directed instances
+ * are therefore solved by a single Martins search.
+ */
+class EpSolverTwoPhase : public AbstractSolver<std::list<ogdf::edge>> {
+public:
+    explicit EpSolverTwoPhase(double epsilon = 0,
+                              unsigned number_of_threads
+                              = std::max(1u, std::thread::hardware_concurrency()))
+    :   epsilon_(epsilon),
+        number_of_threads_(number_of_threads),
+        number_of_triangles_(0) { }
+
+    void Solve(ogdf::Graph& graph,
+               std::function<const Point*(ogdf::edge)> weights,
+               ogdf::node source,
+               ogdf::node target,
+               bool directed = false);
+
+    unsigned number_of_triangles() const {
+        return number_of_triangles_;
+    }
+
+private:
+    const double epsilon_;
+    const unsigned number_of_threads_;
+
+    unsigned number_of_triangles_;
+};
+
+}
+
+#endif /* defined(__mco__ep_two_phase__) */
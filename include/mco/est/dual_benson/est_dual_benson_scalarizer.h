@@ -11,6 +11,9 @@
 
 #include <vector>
 #include <list>
+#include <algorithm>
+#include <ctime>
+#include <utility>
 
 #include <ogdf/basic/Graph.h>
 
@@ -21,15 +24,59 @@
 
 namespace mco {
 
+/**
+ * Solves the weighted sum scalarization by Kruskal's algorithm. Ties of the
+ * weighted costs are broken lexicographically by the cost vectors, such
+ * that the value is a nondominated point. Every adaptor has its own union
+ * find structure, such that several adaptors can solve scalarizations
+ * on the same instance at the same time.
+ */
+class LexKruskalSolverAdaptor {
+public:
+	LexKruskalSolverAdaptor(const AbstractGraphInstance& instance,
+	                        double epsilon = 1E-6)
+	:   instance_(instance),
+	    epsilon_(epsilon),
+	    parents_(instance.graph()) {}
+
+	inline double operator()(const Point& weighting, Point& value);
+
+private:
+	const AbstractGraphInstance& instance_;
+	double epsilon_;
+
+	ogdf::NodeArray<ogdf::node> parents_;
+
+	inline ogdf::node find_set(ogdf::node n);
+};
+
+/**
+ * Extreme supported spanning trees by the dual Benson algorithm, where the
+ * scalarizations are solved by LexKruskalSolverAdaptor.
+ */
 template<class OnlineVertexEnumerator>
 class ESTDualBensonScalarizer : public AbstractESTSolver {
 public:
-	ESTDualBensonScalarizer(AbstractGraphInstance &graph, double epsilon = 1E-6);
-	virtual ~ESTDualBensonScalarizer();
+	ESTDualBensonScalarizer(AbstractGraphInstance &instance, double epsilon = 1E-6)
+	:   AbstractESTSolver(instance),
+	    kruskal_solver_(instance, epsilon),
+	    benson_scalarizer_([this] (const Point& weighting, Point& value) {
+	                           return Solve_scalarization(weighting, value);
+	                       },
+	                       instance.dimension(),
+	                       epsilon),
+	    cycles_(0) {}
 
 	virtual void Solve() {
-		std::list<Point *> solutions;
-		benson_scalarizer_->Calculate_solutions(solutions);
+		std::list<Point *> frontier;
+		benson_scalarizer_.Calculate_solutions(frontier);
+
+		std::list<std::pair<std::list<ogdf::edge>, Point>> solutions;
+
+		for(auto point : frontier) {
+			solutions.push_back(std::make_pair(std::list<ogdf::edge>(), *point));
+			delete point;
+		}
 
 		add_solutions(solutions.begin(), solutions.end());
 	}
@@ -39,34 +86,99 @@ public:
 	}
 
 	double vertex_enumeration_time() {
-		return benson_scalarizer_->vertex_enumeration_time();
+		return benson_scalarizer_.vertex_enumeration_time();
 	}
 
 	int number_vertices() {
-		return benson_scalarizer_->number_vertices();
+		return benson_scalarizer_.number_vertices();
 	}
 
 	int number_facets() {
-		return benson_scalarizer_->number_facets();
+		return benson_scalarizer_.number_facets();
 	}
 
-
 private:
-	double epsilon_;
-	DualBensonScalarizer<OnlineVertexEnumerator> *benson_scalarizer_;
+	LexKruskalSolverAdaptor kruskal_solver_;
+	DualBensonScalarizer<OnlineVertexEnumerator> benson_scalarizer_;
 
-	virtual double Solve_scalarization(Point &weights, Point &value);
+	clock_t cycles_;
 
-	ogdf::NodeArray<ogdf::node> parents_;
+	double Solve_scalarization(const Point &weighting, Point &value) {
+		clock_t start = clock();
+		double cost = kruskal_solver_(weighting, value);
+		cycles_ += clock() - start;
 
-	double kruskal_solver(std::vector<ogdf::edge> &sorted_edges, ogdf::EdgeArray<double> costs, Point &value);
-	void make_set(ogdf::node);
-	ogdf::node find_set(ogdf::node);
-	void set_union(ogdf::node, ogdf::node);
+		return cost;
+	}
+};
 
-	clock_t cycles_;
+inline double LexKruskalSolverAdaptor::
+operator()(const Point& weighting, Point& value) {
+	const ogdf::Graph& graph = instance_.graph();
+	const ogdf::EdgeArray<Point *>& weights = instance_.weights();
+	unsigned int dim = instance_.dimension();
 
-};
+	std::vector<ogdf::edge> sorted_edges;
+	ogdf::EdgeArray<double> weighted_costs(graph);
+
+	for(auto e : graph.edges) {
+		weighted_costs[e] = *weights[e] * weighting;
+		sorted_edges.push_back(e);
+	}
+
+	std::sort(sorted_edges.begin(), sorted_edges.end(), [&] (ogdf::edge e1, ogdf::edge e2) {
+		if(weighted_costs[e1] - weighted_costs[e2] < -epsilon_)
+			return true;
+		else if(weighted_costs[e2] - weighted_costs[e1] < -epsilon_)
+			return false;
+		else
+			for(unsigned int i = 0; i < dim; ++i) {
+				if((*weights[e1])[i] - (*weights[e2])[i] < -epsilon_)
+					return true;
+				if((*weights[e2])[i] - (*weights[e1])[i] < -epsilon_)
+					return false;
+			}
+		return false;
+	});
+
+	for(auto n : graph.nodes) {
+		parents_[n] = n;
+	}
+
+	for(unsigned int i = 0; i < dim; ++i) {
+		value[i] = 0;
+	}
+
+	double cost = 0;
+	for(auto e : sorted_edges) {
+		ogdf::node u = find_set(e->source());
+		ogdf::node v = find_set(e->target());
+
+		if(u != v) {
+			parents_[v] = u;
+			cost += weighted_costs[e];
+			value += *weights[e];
+		}
+	}
+
+	return cost;
+}
+
+inline ogdf::node LexKruskalSolverAdaptor::
+find_set(ogdf::node n) {
+	ogdf::node root = n;
+	while(parents_[root] != root) {
+		root = parents_[root];
+	}
+
+	while(parents_[n] != root) {
+		ogdf::node parent = parents_[n];
+		parents_[n] = root;
+		n = parent;
+	}
+
+	return root;
+}
 
 } /* namespace mco */
 #endif /* EST_DUAL_BENSON_SCALARIZER_H_ */
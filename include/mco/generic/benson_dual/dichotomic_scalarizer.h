@@ -0,0 +1,167 @@
+//
+//  dichotomic_scalarizer.h
+//  mco
+//
+//
+
+#ifndef __mco__dichotomic_scalarizer__
+#define __mco__dichotomic_scalarizer__
+
+#include <list>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include <functional>
+
+#include <mco/basic/point.h>
+#include <mco/basic/thread_pool.h>
+
+namespace mco {
+
+/**
+ * Dual Benson for two objectives by the dichotomic scheme (Aneja and Nair).
+ * For two objectives, the upper boundary of the dual polyhedron is a
+ * concave function on [0, 1], whose breakpoints are given by pairs of
+ * adjacent extreme points. Every such pair is checked by an independent
+ * scalarization, so that the scalarizations are solved in parallel.
+ *
+ * The scalarizations are the same as in DualBensonScalarizer: The first
+ * scalarization is (1, 0), the second (0, 1), and a scalarization yields a
+ * new extreme point if its value is smaller than the value of the
+ * breakpoint by more than epsilon.
+ *
+ * Every worker gets its own solver from solver_factory, such that solvers
+ * with internal state (e.g., LexDijkstraSolverAdaptor) need no locking.
+ */
+class DichotomicScalarizer {
+public:
+    using Solver = std::function<double(const Point& weighting, Point& value)>;
+
+    DichotomicScalarizer(std::function<Solver()> solver_factory,
+                         double epsilon,
+                         unsigned number_of_threads
+                         = std::max(1u, std::thread::hardware_concurrency()))
+    :   epsilon_(epsilon),
+        solver_factory_(solver_factory),
+        number_of_threads_(number_of_threads),
+        vertices_(0),
+        facets_(0) {
+    }
+
+    /**
+     * Adds the extreme points sorted by the first objective.
+     */
+    inline void Calculate_solutions(std::list<Point *>& solutions);
+
+    int number_vertices() { return vertices_; }
+    int number_facets() { return facets_; }
+
+private:
+    double epsilon_;
+
+    std::function<Solver()> solver_factory_;
+    unsigned number_of_threads_;
+
+    std::vector<Solver> solvers_;
+
+    std::mutex mutex_;
+    std::vector<Point *> extreme_points_;
+
+    int vertices_;
+    int facets_;
+
+    inline void explore(const Point& left,
+                        const Point& right,
+                        ThreadPool& pool,
+                        unsigned worker);
+};
+
+inline void DichotomicScalarizer::
+Calculate_solutions(std::list<Point *>& solutions) {
+    ThreadPool pool(number_of_threads_);
+
+    solvers_.clear();
+    for(unsigned i = 0; i < pool.size(); ++i) {
+        solvers_.push_back(solver_factory_());
+    }
+
+    extreme_points_.clear();
+    vertices_ = 1;
+    facets_ = 1;
+
+    Point first(2);
+    solvers_[0](Point({1, 0}), first);
+    extreme_points_.push_back(new Point(first));
+
+    Point second(2);
+    double scalar_value = solvers_[0](Point({0, 1}), second);
+
+    if(scalar_value - first[1] > -epsilon_) {
+        facets_++;
+    } else {
+        extreme_points_.push_back(new Point(second));
+        vertices_++;
+
+        pool.submit([this, &pool, first, second] (unsigned worker) {
+            explore(first, second, pool, worker);
+        });
+
+        pool.wait();
+    }
+
+    std::sort(extreme_points_.begin(),
+              extreme_points_.end(),
+              [] (const Point * p1, const Point * p2) {
+                  return (*p1)[0] < (*p2)[0];
+              });
+
+    solutions.insert(solutions.end(),
+                     extreme_points_.begin(),
+                     extreme_points_.end());
+
+    extreme_points_.clear();
+}
+
+inline void DichotomicScalarizer::
+explore(const Point& left,
+        const Point& right,
+        ThreadPool& pool,
+        unsigned worker) {
+
+    // The weighting where left and right have the same weighted value
+    Point weighting(2);
+    weighting[0] = left[1] - right[1];
+    weighting[1] = right[0] - left[0];
+
+    double sum = weighting[0] + weighting[1];
+    weighting[0] /= sum;
+    weighting[1] = 1 - weighting[0];
+
+    Point value(2);
+    double scalar_value = solvers_[worker](weighting, value);
+
+    if(scalar_value - weighting * left > -epsilon_) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        facets_++;
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        extreme_points_.push_back(new Point(value));
+        vertices_++;
+    }
+
+    pool.submit([this, &pool, left, value] (unsigned worker) {
+        explore(left, value, pool, worker);
+    });
+
+    pool.submit([this, &pool, value, right] (unsigned worker) {
+        explore(value, right, pool, worker);
+    });
+}
+
+}
+
+#endif /* defined(__mco__dichotomic_scalarizer__) */
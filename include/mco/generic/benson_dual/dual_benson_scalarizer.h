@@ -10,9 +10,17 @@
 #define DUAL_BENSON_SCALARIZER_H_
 
 #include <list>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
 #include <functional>
+#include <limits>
+#include <algorithm>
 
 #include <mco/basic/point.h>
+#include <mco/basic/binary_stream.h>
 
 namespace mco {
     
@@ -23,6 +31,11 @@ namespace mco {
  *	Point * next_vertex();
  *	void add_hyperplane(Point &vertex, Point &normal, double rhs);
  *	unsigned int number_of_hyperplanes();
+ *
+ *  Only for checkpoints:
+ *
+ *  OnlineVertexEnumerator(std::istream& checkpoint, unsigned dimension, double epsilon);
+ *  void save(std::ostream& checkpoint) const;
  */
 
 
@@ -37,15 +50,71 @@ public:
 		solver_(solver),
 		vertex_container(nullptr),
 		vertices_(0),
-		facets_(0) {
+		facets_(0),
+        iterations_(0),
+        approximation_tolerance_(0),
+        approximation_error_(0),
+        min_value_(std::numeric_limits<double>::infinity()),
+        max_value_(-std::numeric_limits<double>::infinity()) {
 	}
+    
+    /**
+     * Approximation mode: A candidate vertex is not cut off if its value
+     * exceeds the scalar value by at most tolerance times the range of
+     * the values of the solutions found so far, i.e., the difference of
+     * their largest and smallest component. Then the solutions are only
+     * an approximation of the extreme points, see approximation_error.
+     * With tolerance 0 (the default), all extreme points are found.
+     */
+    void set_approximation_tolerance(double tolerance) {
+        approximation_tolerance_ = tolerance;
+    }
+    
+    /**
+     * The largest gap of a candidate vertex which was not cut off in the
+     * approximation mode. For every weighting, the smallest weighted value
+     * of the solutions exceeds the optimal weighted value by at most this
+     * error (plus epsilon), which bounds the Hausdorff distance of the
+     * approximated and the exact lower image in the weighted sum sense.
+     */
+    double approximation_error() { return approximation_error_; }
 
 	void Calculate_solutions(std::list<Point *>& solutions);
+    
+    /**
+     * Same as Calculate_solutions, but the state of the enumeration is
+     * written to checkpoint_file whenever interval seconds have passed
+     * since the last checkpoint.
+     */
+    void Calculate_solutions(std::list<Point *>& solutions,
+                             const std::string& checkpoint_file,
+                             double interval);
+    
+    /**
+     * Continues the enumeration from checkpoint_file. solutions receives
+     * the solutions found before the checkpoint and the remaining ones.
+     * New checkpoints are written to the same file.
+     */
+    void Resume_solutions(std::list<Point *>& solutions,
+                          const std::string& checkpoint_file,
+                          double interval);
+    
+    /**
+     * Solutions found before the checkpoint in checkpoint_file, i.e., the
+     * ones which Resume_solutions returns without solving them again.
+     */
+    static std::list<Point> checkpoint_solutions(const std::string& checkpoint_file);
 
 	double vertex_enumeration_time();
 
 	int number_vertices() { return vertices_; }
 	int number_facets() { return facets_; }
+    
+    /**
+     * Number of scalarizations of candidate vertices, including those
+     * before a resumed checkpoint.
+     */
+    int number_iterations() { return iterations_; }
 
 protected:
 	unsigned int dimension_;
@@ -58,36 +127,119 @@ private:
 
 	int vertices_;
 	int facets_;
+    int iterations_;
+    
+    double approximation_tolerance_;
+    double approximation_error_;
+    
+    // Smallest and largest component of the solutions found so far
+    double min_value_;
+    double max_value_;
+    
+    // Solutions found by this scalarizer, owned by the caller
+    std::list<Point *> found_solutions_;
+    
+    static const unsigned checkpoint_magic = 0x44434f4d;
+    static const unsigned checkpoint_version = 2;
+    
+    void initialize(std::list<Point *>& solutions);
+    
+    template<typename IterationCallback>
+    void enumerate(std::list<Point *>& solutions, IterationCallback callback);
+    
+    void save_checkpoint(const std::string& checkpoint_file);
+    void load_checkpoint(const std::string& checkpoint_file);
+    static void check_header(std::istream& checkpoint, const std::string& checkpoint_file);
+    
+    void add_solution(std::list<Point *>& solutions, const Point& value);
 };
     
 template<typename OnlineVertexEnumerator>
 void DualBensonScalarizer<OnlineVertexEnumerator>::
 Calculate_solutions(std::list<Point *>& solutions) {
-    int nondominated_values = 1;
-    int iteration_counter = 0;
-    int weighting_counter = 1;
+    initialize(solutions);
+    enumerate(solutions, [] () {});
+}
+    
+template<typename OnlineVertexEnumerator>
+void DualBensonScalarizer<OnlineVertexEnumerator>::
+Calculate_solutions(std::list<Point *>& solutions,
+                    const std::string& checkpoint_file,
+                    double interval) {
+    
+    using clock = std::chrono::steady_clock;
+    
+    initialize(solutions);
+    
+    auto last_checkpoint = clock::now();
+    enumerate(solutions, [&] () {
+        if(std::chrono::duration<double>(clock::now() - last_checkpoint).count() >= interval) {
+            save_checkpoint(checkpoint_file);
+            last_checkpoint = clock::now();
+        }
+    });
+}
+    
+template<typename OnlineVertexEnumerator>
+void DualBensonScalarizer<OnlineVertexEnumerator>::
+Resume_solutions(std::list<Point *>& solutions,
+                 const std::string& checkpoint_file,
+                 double interval) {
+    
+    using clock = std::chrono::steady_clock;
+    
+    load_checkpoint(checkpoint_file);
+    solutions.insert(solutions.end(),
+                     found_solutions_.begin(),
+                     found_solutions_.end());
+    
+    auto last_checkpoint = clock::now();
+    enumerate(solutions, [&] () {
+        if(std::chrono::duration<double>(clock::now() - last_checkpoint).count() >= interval) {
+            save_checkpoint(checkpoint_file);
+            last_checkpoint = clock::now();
+        }
+    });
+}
+    
+template<typename OnlineVertexEnumerator>
+void DualBensonScalarizer<OnlineVertexEnumerator>::
+initialize(std::list<Point *>& solutions) {
+    found_solutions_.clear();
+    vertices_ = 1;
+    facets_ = 1;
+    iterations_ = 0;
+    approximation_error_ = 0;
+    min_value_ = std::numeric_limits<double>::infinity();
+    max_value_ = -std::numeric_limits<double>::infinity();
     
     Point v(dimension_);
     Point value(dimension_);
     
     for(unsigned int i = 0; i < dimension_ - 1; ++i)
         v[i] = 0;
-        v[0] = 1;
-
-        v[dimension_ - 1] = solver_(v, value);
+    v[0] = 1;
     
-        solutions.push_back(new Point(value));
-        
-        vertex_container = new OnlineVertexEnumerator(value, dimension_, epsilon_);
-        delete vertex_container->next_vertex();
-        
-        Point *candidate, weighting(dimension_), inequality(dimension_);
-        double scalar_value;
+    v[dimension_ - 1] = solver_(v, value);
+    
+    add_solution(solutions, value);
+    
+    vertex_container = new OnlineVertexEnumerator(value, dimension_, epsilon_);
+    delete vertex_container->next_vertex();
+}
+    
+template<typename OnlineVertexEnumerator>
+template<typename IterationCallback>
+void DualBensonScalarizer<OnlineVertexEnumerator>::
+enumerate(std::list<Point *>& solutions, IterationCallback callback) {
+    
+    Point *candidate, weighting(dimension_), inequality(dimension_), value(dimension_);
+    double scalar_value;
     while(vertex_container->has_next()) {
-        iteration_counter++;
+        iterations_++;
         
 #ifndef NDEBUG
-        std::cout << "Iteration: " << iteration_counter << std::endl;
+        std::cout << "Iteration: " << iterations_ << std::endl;
 #endif
         
         candidate = vertex_container->next_vertex();
@@ -117,11 +269,18 @@ Calculate_solutions(std::list<Point *>& solutions) {
         std::cout << "value vector: " << value << std::endl;
 #endif
         
-        if(scalar_value - (*candidate)[dimension_ - 1] > -epsilon_) {
-            weighting_counter++;
+        double gap = (*candidate)[dimension_ - 1] - scalar_value;
+        
+        if(gap < epsilon_) {
+            facets_++;
 #ifndef NDEBUG
             std::cout << "found a new permanent extreme point. continuing." << std::endl;
             
+#endif
+        } else if(gap <= approximation_tolerance_ * (max_value_ - min_value_)) {
+            approximation_error_ = std::max(approximation_error_, gap);
+#ifndef NDEBUG
+            std::cout << "gap " << gap << " is within the approximation tolerance. continuing." << std::endl;
 #endif
         } else {
             
@@ -130,24 +289,151 @@ Calculate_solutions(std::list<Point *>& solutions) {
             inequality[dimension_ - 1] = -1;
             
             vertex_container->add_hyperplane(*candidate, inequality, -value[dimension_ - 1]);
-            nondominated_values++;
+            vertices_++;
             
-            solutions.push_back(new Point(value));
+            add_solution(solutions, value);
             
         }
         
         delete candidate;
         
+        callback();
     }
     
-    vertices_ = nondominated_values;
-    facets_ = weighting_counter;
-    
-    //	std::cout << "Found " << nondominated_values << " nondominated value vectors in " << iteration_counter << " iterations." << std::endl;
-    //	std::cout << "Where " << weighting_counter << " weightings have been explored." << std::endl;
+    //	std::cout << "Found " << vertices_ << " nondominated value vectors in " << iterations_ << " iterations." << std::endl;
+    //	std::cout << "Where " << facets_ << " weightings have been explored." << std::endl;
     
     delete vertex_container;
 }
+    
+template<typename OnlineVertexEnumerator>
+void DualBensonScalarizer<OnlineVertexEnumerator>::
+add_solution(std::list<Point *>& solutions, const Point& value) {
+    Point* solution = new Point(value);
+    
+    solutions.push_back(solution);
+    found_solutions_.push_back(solution);
+    
+    for(auto component = value.cbegin(); component != value.cend(); ++component) {
+        min_value_ = std::min(min_value_, *component);
+        max_value_ = std::max(max_value_, *component);
+    }
+}
+    
+template<typename OnlineVertexEnumerator>
+void DualBensonScalarizer<OnlineVertexEnumerator>::
+save_checkpoint(const std::string& checkpoint_file) {
+    
+    // The previous checkpoint is only replaced by a complete one
+    std::string temporary_file = checkpoint_file + ".tmp";
+    
+    {
+        std::ofstream checkpoint(temporary_file, std::ios::binary | std::ios::trunc);
+        
+        BinaryStream::write<unsigned>(checkpoint, checkpoint_magic);
+        BinaryStream::write<unsigned>(checkpoint, checkpoint_version);
+        BinaryStream::write<unsigned>(checkpoint, dimension_);
+        BinaryStream::write<double>(checkpoint, epsilon_);
+        
+        BinaryStream::write<int>(checkpoint, vertices_);
+        BinaryStream::write<int>(checkpoint, facets_);
+        BinaryStream::write<int>(checkpoint, iterations_);
+        BinaryStream::write<double>(checkpoint, approximation_error_);
+        
+        BinaryStream::write<unsigned>(checkpoint, found_solutions_.size());
+        for(auto solution : found_solutions_) {
+            BinaryStream::write(checkpoint, *solution);
+        }
+        
+        vertex_container->save(checkpoint);
+        
+        if(!checkpoint) {
+            throw std::runtime_error("Could not write checkpoint " + temporary_file);
+        }
+    }
+    
+    if(std::rename(temporary_file.c_str(), checkpoint_file.c_str()) != 0) {
+        throw std::runtime_error("Could not replace checkpoint " + checkpoint_file);
+    }
+}
+    
+template<typename OnlineVertexEnumerator>
+void DualBensonScalarizer<OnlineVertexEnumerator>::
+load_checkpoint(const std::string& checkpoint_file) {
+    
+    std::ifstream checkpoint(checkpoint_file, std::ios::binary);
+    if(!checkpoint) {
+        throw std::runtime_error("Could not open checkpoint " + checkpoint_file);
+    }
+    
+    check_header(checkpoint, checkpoint_file);
+    
+    if(BinaryStream::read<unsigned>(checkpoint) != dimension_) {
+        throw std::runtime_error("Checkpoint " + checkpoint_file + " has a different dimension");
+    }
+    
+    // The epsilon of the checkpoint is kept, so that the enumeration
+    // continues as before
+    epsilon_ = BinaryStream::read<double>(checkpoint);
+    
+    vertices_ = BinaryStream::read<int>(checkpoint);
+    facets_ = BinaryStream::read<int>(checkpoint);
+    iterations_ = BinaryStream::read<int>(checkpoint);
+    approximation_error_ = BinaryStream::read<double>(checkpoint);
+    
+    found_solutions_.clear();
+    min_value_ = std::numeric_limits<double>::infinity();
+    max_value_ = -std::numeric_limits<double>::infinity();
+    
+    // The solutions are returned by Resume_solutions
+    std::list<Point *> solutions;
+    
+    unsigned number_of_solutions = BinaryStream::read<unsigned>(checkpoint);
+    for(unsigned i = 0; i < number_of_solutions; ++i) {
+        add_solution(solutions, BinaryStream::read_point(checkpoint));
+    }
+    
+    vertex_container = new OnlineVertexEnumerator(checkpoint, dimension_, epsilon_);
+}
+
+template<typename OnlineVertexEnumerator>
+std::list<Point> DualBensonScalarizer<OnlineVertexEnumerator>::
+checkpoint_solutions(const std::string& checkpoint_file) {
+    
+    std::ifstream checkpoint(checkpoint_file, std::ios::binary);
+    if(!checkpoint) {
+        throw std::runtime_error("Could not open checkpoint " + checkpoint_file);
+    }
+    
+    check_header(checkpoint, checkpoint_file);
+    
+    // Dimension, epsilon and the counters
+    BinaryStream::read<unsigned>(checkpoint);
+    BinaryStream::read<double>(checkpoint);
+    BinaryStream::read<int>(checkpoint);
+    BinaryStream::read<int>(checkpoint);
+    BinaryStream::read<int>(checkpoint);
+    BinaryStream::read<double>(checkpoint);
+    
+    std::list<Point> solutions;
+    
+    unsigned number_of_solutions = BinaryStream::read<unsigned>(checkpoint);
+    for(unsigned i = 0; i < number_of_solutions; ++i) {
+        solutions.push_back(BinaryStream::read_point(checkpoint));
+    }
+    
+    return solutions;
+}
+    
+template<typename OnlineVertexEnumerator>
+void DualBensonScalarizer<OnlineVertexEnumerator>::
+check_header(std::istream& checkpoint, const std::string& checkpoint_file) {
+    
+    if(BinaryStream::read<unsigned>(checkpoint) != checkpoint_magic ||
+       BinaryStream::read<unsigned>(checkpoint) != checkpoint_version) {
+        throw std::runtime_error(checkpoint_file + " is not a dual Benson checkpoint");
+    }
+}
 
 template<typename OnlineVertexEnumerator>
 double DualBensonScalarizer<OnlineVertexEnumerator>::
@@ -13,9 +13,18 @@
 #include <vector>
 #include <algorithm>
 #include <set>
+#include <memory>
+#include <thread>
+#include <string>
+#include <istream>
+#include <ostream>
 
+#include <mco/basic/dynamic_bitset.h>
+#include <mco/basic/object_pool.h>
+#include <mco/basic/thread_pool.h>
 #include <mco/generic/benson_dual/abstract_online_vertex_enumerator.h>
 #include <mco/geometric/projective_geometry_utilities.h>
+#include <mco/geometric/robust_predicates.h>
 
 namespace mco {
     
@@ -28,6 +37,14 @@ public:
                  unsigned dimension,
                  double epsilon);
     
+    /**
+     * Restores an enumerator written by save. Throws std::runtime_error if
+     * the checkpoint is truncated or does not fit the dimension.
+     */
+    GraphlessOVE(std::istream& checkpoint,
+                 unsigned dimension,
+                 double epsilon);
+    
     template<typename ConstIterator>
     GraphlessOVE(unsigned dimension,
                  ConstIterator extreme_points_begin,
@@ -45,6 +62,54 @@ public:
     void add_hyperplane(Point &vertex, Point &normal, double rhs);
     
     unsigned int number_of_hyperplanes() { return inequalities_.size(); }
+    
+    /**
+     * Number of threads classifying the extreme points against a new
+     * hyperplane, if there are many extreme points.
+     */
+    void set_number_of_threads(unsigned number_of_threads) {
+        number_of_threads_ = std::max(1u, number_of_threads);
+        pool_.reset();
+    }
+    
+    /**
+     * Number of current extreme points.
+     */
+    unsigned live_vertices() const {
+        return extreme_points_.size() - free_rows_.size();
+    }
+    
+    /**
+     * Number of removed vertices whose memory is not yet reclaimed, e.g.,
+     * because they are still in the pending queue.
+     */
+    unsigned dead_vertices() const {
+        return vertex_pool_.size() - live_vertices();
+    }
+    
+    /**
+     * Number of side tests which were ambiguous in floating point and
+     * decided by exact arithmetic.
+     */
+    unsigned exact_evaluations() const {
+        return exact_evaluations_;
+    }
+    
+    /**
+     * Largest bound of the absolute errors of the coordinates of the
+     * extreme points, which accumulate the rounding errors of the cut
+     * point computations.
+     */
+    double coordinate_error() const;
+    
+    std::string statistics() const;
+    
+    /**
+     * Writes the inequalities and the current extreme points with their
+     * active inequalities, such that the enumeration can be continued
+     * from a checkpoint. Removed vertices are not written.
+     */
+    void save(std::ostream& checkpoint) const;
 
 private:
     class GraphlessPoint : public Point {
@@ -61,18 +126,34 @@ private:
         
         inline virtual ~GraphlessPoint();
         
-        std::list<unsigned> active_inequalities_;
+        DynamicBitset active_inequalities_;
         unsigned birth_index_;
+        unsigned row_;
+        
+        // Sum of the absolute coordinates
+        double norm_ = 0;
+        
+        // Bound of the absolute errors of the coordinates with respect to
+        // the vertex given by the active inequalities
+        double error_ = 0;
+        
         bool removed = false;
+        bool pending = false;
         
         inline void set_father(GraphlessPoint* father);
         
         GraphlessPoint const * father() const { return father_point_; }
     private:
         GraphlessPoint* father_point_ = nullptr;
-        std::list<GraphlessPoint*> children_;
+        
+        // Intrusive doubly linked list of the children
+        GraphlessPoint* first_child_ = nullptr;
+        GraphlessPoint* next_sibling_ = nullptr;
+        GraphlessPoint* previous_sibling_ = nullptr;
     };
     
+    ObjectPool<GraphlessPoint> vertex_pool_;
+    
     bool check_adjacent(GraphlessPoint& point1,
                         const GraphlessPoint& point2);
     
@@ -85,12 +166,88 @@ private:
     inline void pop_pending();
     inline GraphlessPoint* top_pending();
     
+    // Number of removed points in pending_points_
+    unsigned removed_pending_ = 0;
+    
+    void compact_pending();
+    void compact_rows();
+    
     std::list<GraphlessPoint*> candidate_points_;
     
-    std::list<GraphlessPoint*> extreme_points_;
+    // Extreme points by their row in coordinates_, nullptr for free rows
+    std::vector<GraphlessPoint*> extreme_points_;
+    std::vector<unsigned> free_rows_;
+    
+    // Row-major coordinates of the extreme points
+    std::vector<double> coordinates_;
+    std::vector<double> distances_;
+    
+    unsigned number_of_threads_ = std::max(1u, std::thread::hardware_concurrency());
+    std::unique_ptr<ThreadPool> pool_;
+    
+    inline void add_extreme_point(GraphlessPoint* point);
+    inline void remove_extreme_point(GraphlessPoint* point);
+    
+    void classify(const Point& hyperplane,
+                  std::vector<unsigned>& cut_off_rows,
+                  std::vector<unsigned>& inside_rows,
+                  std::vector<unsigned>& on_plane_rows);
+    
+    /**
+     * Side of point with respect to hyperplane, given the floating point
+     * distance of the point and the largest absolute coefficient of the
+     * hyperplane: -1 if the distance is smaller than -epsilon, 1 if it is
+     * larger than epsilon and 0 otherwise. Distances whose error bound
+     * contains -epsilon or epsilon are decided by exact_side.
+     */
+    inline int side(const GraphlessPoint& point,
+                    const Point& hyperplane,
+                    double hyperplane_norm,
+                    double distance);
+    
+    /**
+     * Side of point with respect to hyperplane, where the point is given
+     * by its active inequalities instead of its rounded coordinates. Only
+     * evaluated exactly if the floating point determinants are ambiguous.
+     * Returns the side of the rounded distance if the active inequalities
+     * do not determine the point.
+     */
+    int exact_side(const GraphlessPoint& point,
+                   const Point& hyperplane,
+                   double distance);
+    
+    /**
+     * Up to dimension_ linearly independent active inequalities of point,
+     * selected by Gaussian elimination in floating point.
+     */
+    std::vector<std::vector<double>> independent_active_rows(const GraphlessPoint& point) const;
+    
+    /**
+     * Bound of the absolute errors of the coordinates of the finite point
+     * with respect to the vertex given by its active inequalities, from
+     * the residuals of the inequalities and a verified bound of the norm of
+     * the inverse of their matrix. Infinite if the active inequalities do
+     * not determine the point.
+     */
+    double vertex_error(const GraphlessPoint& point) const;
+    
+    /**
+     * Bound of the difference of the floating point distance of point to a
+     * hyperplane and the distance of the vertex given by the active
+     * inequalities, given the largest absolute coefficient of the
+     * hyperplane. Holds for dot products of the coordinates, compensated
+     * or not.
+     */
+    inline double distance_error(const GraphlessPoint& point,
+                                 double hyperplane_norm) const;
+    
+    unsigned exact_evaluations_ = 0;
     
     std::list<GraphlessPoint*> permanent_points_;
     std::vector<Point> inequalities_;
+    
+    // Largest absolute coefficients of the inequalities
+    std::vector<double> inequality_norms_;
 };
     
 template<typename ConstIterator>
@@ -106,11 +263,12 @@ GraphlessOVE::GraphlessOVE(unsigned dimension,
     
     GraphlessPoint* new_point;
     for(auto it = extreme_points_begin; it != extreme_points_end; ++it) {
-        new_point = new GraphlessPoint(dimension_ + 1);
+        new_point = vertex_pool_.create(dimension_ + 1);
         std::copy(it->cbegin(), it->cend(), new_point->begin());
         new_point->operator[](dimension_) = 1;
+        new_point->pending = true;
         pending_points_.push_back(new_point);
-        extreme_points_.push_back(new_point);
+        add_extreme_point(new_point);
     }
     
     make_heap(pending_points_.begin(),
@@ -119,11 +277,11 @@ GraphlessOVE::GraphlessOVE(unsigned dimension,
     
     GraphlessPoint* new_ray;
     for(auto it = extreme_rays_begin; it != extreme_rays_end; ++it) {
-        new_ray = new GraphlessPoint(dimension_ + 1);
+        new_ray = vertex_pool_.create(dimension_ + 1);
         std::copy(it->cbegin(), it->cend(), new_ray->begin());
         new_ray->operator[](dimension_) = 0;
         permanent_points_.push_back(new_ray);
-        extreme_points_.push_back(new_ray);
+        add_extreme_point(new_ray);
     }
     
     std::copy(inequalities_begin,
@@ -132,10 +290,7 @@ GraphlessOVE::GraphlessOVE(unsigned dimension,
 }
     
 GraphlessOVE::~GraphlessOVE() {
-    for(auto p: extreme_points_) {
-        delete p;
-    }
-    
+    // All vertices are destroyed by the vertex pool
 }
     
 inline Point * GraphlessOVE::
@@ -146,8 +301,10 @@ next_vertex() {
                    LexPointComparator(epsilon_)));
     
     while(top_pending()->removed) {
-        delete top_pending();
+        GraphlessPoint* removed_point = top_pending();
         pop_pending();
+        vertex_pool_.destroy(removed_point);
+        --removed_pending_;
     }
     
     candidate_points_.push_back(top_pending());
@@ -163,16 +320,79 @@ has_next() {
                    LexPointComparator(epsilon_)));
 
     while(!pending_points_.empty() && top_pending()->removed) {
-        delete top_pending();
+        GraphlessPoint* removed_point = top_pending();
         pop_pending();
+        vertex_pool_.destroy(removed_point);
+        --removed_pending_;
     }
     
     return !pending_points_.empty();
 }
     
+inline void GraphlessOVE::
+add_extreme_point(GraphlessPoint* point) {
+    
+    unsigned stride = dimension_ + 1;
+    
+    if(free_rows_.empty()) {
+        point->row_ = extreme_points_.size();
+        extreme_points_.push_back(point);
+        coordinates_.resize(coordinates_.size() + stride);
+    } else {
+        point->row_ = free_rows_.back();
+        free_rows_.pop_back();
+        extreme_points_[point->row_] = point;
+    }
+    
+    std::copy(point->cbegin(),
+              point->cend(),
+              coordinates_.begin() + point->row_ * stride);
+    
+    point->norm_ = 0;
+    for(auto coordinate = point->cbegin(); coordinate != point->cend(); ++coordinate) {
+        point->norm_ += std::abs(*coordinate);
+    }
+}
+
+inline void GraphlessOVE::
+remove_extreme_point(GraphlessPoint* point) {
+    extreme_points_[point->row_] = nullptr;
+    free_rows_.push_back(point->row_);
+}
+    
+inline double GraphlessOVE::
+distance_error(const GraphlessPoint& point,
+               double hyperplane_norm) const {
+    
+    // Errors of the coordinates weighted by the hyperplane, and the
+    // rounding errors of a dot product of dimension_ + 1 terms
+    return hyperplane_norm * ((dimension_ + 1) * point.error_
+                              + (dimension_ + 2) * RobustPredicates::epsilon * point.norm_);
+}
+    
+inline int GraphlessOVE::
+side(const GraphlessPoint& point,
+     const Point& hyperplane,
+     double hyperplane_norm,
+     double distance) {
+    
+    double error_bound = distance_error(point, hyperplane_norm);
+    
+    if(distance < -epsilon_ - error_bound) {
+        return -1;
+    } else if(distance > epsilon_ + error_bound) {
+        return 1;
+    } else if(std::abs(distance) < epsilon_ - error_bound) {
+        return 0;
+    }
+    
+    return exact_side(point, hyperplane, distance);
+}
+    
 inline void GraphlessOVE::
 push_pending(GraphlessPoint* point) {
     
+    point->pending = true;
     pending_points_.push_back(point);
     
     std::push_heap(pending_points_.begin(),
@@ -183,6 +403,7 @@ push_pending(GraphlessPoint* point) {
 inline void GraphlessOVE::
 pop_pending() {
     
+    top_pending()->pending = false;
     std::pop_heap(pending_points_.begin(),
                   pending_points_.end(),
                   LexPointComparator(epsilon_));
@@ -196,21 +417,43 @@ top_pending() -> GraphlessPoint* {
     
 inline GraphlessOVE::GraphlessPoint::
 ~GraphlessPoint() {
-    for(auto child : children_) {
+    GraphlessPoint* child = first_child_;
+    while(child != nullptr) {
         assert(child->father_point_ == this);
+        
+        GraphlessPoint* next_child = child->next_sibling_;
+        
         child->father_point_ = nullptr;
+        child->next_sibling_ = nullptr;
+        child->previous_sibling_ = nullptr;
+        
+        child = next_child;
     }
     
-    // FIXME more efficient
     if(father_point_ != nullptr) {
-        father_point_->children_.remove(this);
+        if(previous_sibling_ != nullptr) {
+            previous_sibling_->next_sibling_ = next_sibling_;
+        } else {
+            father_point_->first_child_ = next_sibling_;
+        }
+        
+        if(next_sibling_ != nullptr) {
+            next_sibling_->previous_sibling_ = previous_sibling_;
+        }
     }
 }
     
 inline void GraphlessOVE::GraphlessPoint::
 set_father(GraphlessPoint* father) {
+    assert(father_point_ == nullptr);
+    
     father_point_ = father;
-    father->children_.push_back(this);
+    
+    next_sibling_ = father->first_child_;
+    if(next_sibling_ != nullptr) {
+        next_sibling_->previous_sibling_ = this;
+    }
+    father->first_child_ = this;
 }
     
 }
@@ -0,0 +1,237 @@
+//
+//  ove_planar_subdivision.h
+//  mco
+//
+//
+
+#ifndef __mco__ove_planar_subdivision__
+#define __mco__ove_planar_subdivision__
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include <mco/basic/point.h>
+#include <mco/basic/lex_point_comparator.h>
+#include <mco/basic/object_pool.h>
+#include <mco/generic/benson_dual/abstract_online_vertex_enumerator.h>
+
+namespace mco {
+
+/**
+ * Online vertex enumerator for the dual polyhedron of three objectives. The
+ * upper boundary of the dual polyhedron is a concave function on the
+ * weight triangle, whose linear pieces form a planar subdivision of the
+ * triangle. The subdivision is kept as a doubly connected edge list. A new
+ * hyperplane cuts off a convex region of the triangle, which is found by
+ * walking from the last candidate through the cut off vertices, so that
+ * only the faces touching the region are changed.
+ *
+ * Vertices are (w_1, w_2, y), where (w_1, w_2, 1 - w_1 - w_2) is the
+ * weighting and y the value of the upper boundary.
+ */
+class PlanarSubdivisionOVE :
+public AbstractOnlineVertexEnumerator {
+public:
+    PlanarSubdivisionOVE(const Point& initial_value,
+                         unsigned dimension,
+                         double epsilon);
+
+    PlanarSubdivisionOVE(const PlanarSubdivisionOVE&) = delete;
+    PlanarSubdivisionOVE& operator=(const PlanarSubdivisionOVE&) = delete;
+
+    inline bool has_next();
+
+    inline Point * next_vertex();
+
+    void add_hyperplane(Point &vertex, Point &normal, double rhs);
+
+    unsigned int number_of_hyperplanes() { return number_of_hyperplanes_; }
+
+    unsigned number_of_vertices() const {
+        return vertices_.size();
+    }
+
+    /**
+     * Number of faces of the subdivision, i.e., the number of
+     * hyperplanes which support the upper boundary.
+     */
+    unsigned number_of_faces() const {
+        return number_of_faces_;
+    }
+
+private:
+    struct HalfEdge;
+    struct Face;
+
+    struct Vertex {
+        Vertex(Point&& point)
+        :   point(std::move(point)) { }
+
+        Point point;
+
+        // Some outgoing half-edge
+        HalfEdge* edge = nullptr;
+
+        // On the boundary of the weight triangle
+        bool corner = false;
+
+        bool removed = false;
+        bool pending = false;
+
+        // Position in vertices_
+        unsigned index;
+
+        unsigned long distance_stamp = 0;
+        double distance;
+
+        unsigned long cut_stamp = 0;
+
+        HalfEdge* new_face_edge = nullptr;
+    };
+
+    struct HalfEdge {
+        Vertex* origin = nullptr;
+        HalfEdge* twin = nullptr;
+        HalfEdge* next = nullptr;
+        HalfEdge* prev = nullptr;
+        Face* face = nullptr;
+
+        unsigned long split_stamp = 0;
+        Vertex* split = nullptr;
+
+        bool dead = false;
+    };
+
+    struct Face {
+        HalfEdge* edge = nullptr;
+
+        // The outside of the weight triangle
+        bool outer = false;
+
+        unsigned long stamp = 0;
+        bool removed = false;
+    };
+
+    // A chain of cut off vertices on the boundary of a face, from the
+    // head of in to the origin of out
+    struct Chain {
+        Face* face;
+        HalfEdge* in;
+        HalfEdge* out;
+        std::vector<Vertex*> corners;
+    };
+
+    class VertexComparator {
+    public:
+        VertexComparator(double epsilon)
+        :   comparator_(epsilon) { }
+
+        bool operator()(const Vertex* v1, const Vertex* v2) const {
+            return comparator_(v1->point, v2->point);
+        }
+
+    private:
+        LexPointComparator comparator_;
+    };
+
+    ObjectPool<Vertex> vertex_pool_;
+    ObjectPool<HalfEdge> edge_pool_;
+    ObjectPool<Face> face_pool_;
+
+    Face* outer_face_;
+
+    std::vector<Vertex*> vertices_;
+
+    std::vector<Vertex*> pending_vertices_;
+    unsigned removed_pending_ = 0;
+
+    Vertex* last_candidate_ = nullptr;
+
+    unsigned number_of_hyperplanes_;
+    unsigned number_of_faces_ = 0;
+
+    // Current hyperplane
+    unsigned long stamp_ = 0;
+    const Point* normal_ = nullptr;
+    double rhs_ = 0;
+
+    inline double distance(Vertex* vertex);
+
+    inline bool is_cut(const Vertex* vertex) const {
+        return vertex->cut_stamp == stamp_;
+    }
+
+    Vertex* create_vertex(Point&& point, bool corner);
+    void remove_vertex(Vertex* vertex);
+
+    HalfEdge* create_edge(Vertex* origin,
+                          Vertex* destination,
+                          Face* face,
+                          Face* twin_face);
+
+    Vertex* split(HalfEdge* edge);
+
+    inline void push_pending(Vertex* vertex);
+    inline void pop_pending();
+
+    void compact_pending();
+};
+
+inline double PlanarSubdivisionOVE::
+distance(Vertex* vertex) {
+    if(vertex->distance_stamp != stamp_) {
+        vertex->distance = *normal_ * vertex->point - rhs_;
+        vertex->distance_stamp = stamp_;
+    }
+
+    return vertex->distance;
+}
+
+inline bool PlanarSubdivisionOVE::
+has_next() {
+    while(!pending_vertices_.empty() && pending_vertices_.front()->removed) {
+        Vertex* removed_vertex = pending_vertices_.front();
+        pop_pending();
+        vertex_pool_.destroy(removed_vertex);
+        --removed_pending_;
+    }
+
+    return !pending_vertices_.empty();
+}
+
+inline Point * PlanarSubdivisionOVE::
+next_vertex() {
+    bool next = has_next();
+    assert(next);
+    (void) next;
+
+    last_candidate_ = pending_vertices_.front();
+    pop_pending();
+
+    return new Point(last_candidate_->point);
+}
+
+inline void PlanarSubdivisionOVE::
+push_pending(Vertex* vertex) {
+    vertex->pending = true;
+    pending_vertices_.push_back(vertex);
+
+    std::push_heap(pending_vertices_.begin(),
+                   pending_vertices_.end(),
+                   VertexComparator(epsilon_));
+}
+
+inline void PlanarSubdivisionOVE::
+pop_pending() {
+    pending_vertices_.front()->pending = false;
+
+    std::pop_heap(pending_vertices_.begin(),
+                  pending_vertices_.end(),
+                  VertexComparator(epsilon_));
+    pending_vertices_.pop_back();
+}
+
+}
+
+#endif /* defined(__mco__ove_planar_subdivision__) */
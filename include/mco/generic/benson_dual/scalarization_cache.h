@@ -0,0 +1,181 @@
+//
+//  scalarization_cache.h
+//  mco
+//
+//
+
+#ifndef __mco__scalarization_cache__
+#define __mco__scalarization_cache__
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+
+#include <mco/basic/point.h>
+
+namespace mco {
+
+/**
+ * Solver adaptor which answers a weighting without calling the solver if
+ * a known solution is provably optimal for it. For every known solution,
+ * the cache stores the weightings for which the solution was optimal. The
+ * value of the weighted sum scalarization is concave in the weighting, so
+ * a solution optimal for two weightings is optimal on the segment between
+ * them. A weighting is answered from the cache if it lies on such a
+ * segment of the solution minimizing the weighted value among the known
+ * solutions (or is one of its weightings).
+ *
+ * In the dual Benson algorithm, such weightings are candidate vertices on
+ * an edge of the outer approximation between two permanent vertices, which
+ * occur for degenerate instances. Since a cached solution is already
+ * known, the candidate vertex is always permanent, so the solutions of the
+ * algorithm do not change. Side effects of the solver, e.g., callbacks,
+ * only happen for the weightings which are actually solved.
+ */
+class ScalarizationCache {
+public:
+    using Solver = std::function<double(const Point& weighting, Point& value)>;
+
+    ScalarizationCache(Solver solver, double epsilon = 1E-8)
+    :   solver_(solver),
+        epsilon_(epsilon) { }
+
+    inline double operator()(const Point& weighting, Point& value);
+
+    /**
+     * Number of weightings answered without calling the solver.
+     */
+    unsigned hits() const { return hits_; }
+
+    /**
+     * Number of weightings passed to the solver.
+     */
+    unsigned misses() const { return misses_; }
+
+private:
+    struct Solution {
+        Solution(const Point& value)
+        :   value(value) { }
+
+        Point value;
+
+        // Weightings for which value is optimal
+        std::vector<Point> weightings;
+    };
+
+    Solver solver_;
+    double epsilon_;
+
+    std::vector<Solution> solutions_;
+
+    // Weighted values of the known solutions for the current weighting
+    std::vector<double> weighted_values_;
+
+    unsigned hits_ = 0;
+    unsigned misses_ = 0;
+
+    inline bool on_segment(const Point& weighting,
+                           const Point& first,
+                           const Point& second) const;
+};
+
+inline double ScalarizationCache::
+operator()(const Point& weighting, Point& value) {
+
+    weighted_values_.resize(solutions_.size());
+
+    unsigned best = 0;
+    for(unsigned i = 0; i < solutions_.size(); ++i) {
+        weighted_values_[i] = weighting * solutions_[i].value;
+
+        if(weighted_values_[i] < weighted_values_[best]) {
+            best = i;
+        }
+    }
+
+    if(!solutions_.empty()) {
+        Solution& solution = solutions_[best];
+        auto& weightings = solution.weightings;
+
+        for(unsigned i = 0; i < weightings.size(); ++i) {
+            for(unsigned j = i; j < weightings.size(); ++j) {
+                if(on_segment(weighting, weightings[i], weightings[j])) {
+                    ++hits_;
+
+                    weightings.push_back(weighting);
+                    value = solution.value;
+
+                    return weighted_values_[best];
+                }
+            }
+        }
+    }
+
+    ++misses_;
+
+    double scalar_value = solver_(weighting, value);
+
+    // All known solutions attaining the optimal value are optimal for the
+    // weighting, which is the case for many solutions of degenerate
+    // instances
+    bool known = false;
+    for(unsigned i = 0; i < solutions_.size(); ++i) {
+        if(weighted_values_[i] <= scalar_value + epsilon_) {
+            solutions_[i].weightings.push_back(weighting);
+        }
+
+        if(!known) {
+            known = std::equal(value.cbegin(),
+                               value.cend(),
+                               solutions_[i].value.cbegin(),
+                               [this] (double a, double b) {
+                                   return std::abs(a - b) <= epsilon_;
+                               });
+        }
+    }
+
+    if(!known) {
+        solutions_.emplace_back(value);
+        solutions_.back().weightings.push_back(weighting);
+    }
+
+    return scalar_value;
+}
+
+inline bool ScalarizationCache::
+on_segment(const Point& weighting,
+           const Point& first,
+           const Point& second) const {
+
+    // Parameter of the projection of weighting onto the line through first
+    // and second
+    double length = 0;
+    double projection = 0;
+    for(unsigned i = 0; i < weighting.dimension(); ++i) {
+        double direction = second[i] - first[i];
+        length += direction * direction;
+        projection += direction * (weighting[i] - first[i]);
+    }
+
+    double alpha = length > 0 ? projection / length : 0;
+
+    if(alpha < 0 || alpha > 1) {
+        return false;
+    }
+
+    for(unsigned i = 0; i < weighting.dimension(); ++i) {
+        double point = first[i] + alpha * (second[i] - first[i]);
+
+        if(std::abs(weighting[i] - point) > epsilon_) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+#endif /* defined(__mco__scalarization_cache__) */
@@ -0,0 +1,546 @@
+//
+//  lower_convex_hull.h
+//  mco
+//
+//
+
+#ifndef __mco__lower_convex_hull__
+#define __mco__lower_convex_hull__
+
+#include <map>
+#include <list>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include <mco/basic/point.h>
+#include <mco/geometric/robust_predicates.h>
+
+namespace mco {
+
+/**
+ * Maintains the supported points of a two-dimensional point set, i.e., the
+ * extreme points of conv(P) + R^2_+. The supported points are kept in a
+ * chain sorted by their first component (and thus strictly decreasing in
+ * their second component), such that an insertion costs O(log n) plus the
+ * number of points which are removed from the chain. Dominance is decided
+ * up to epsilon, convexity by an exact orientation predicate.
+ */
+template<typename T>
+class LowerConvexHull2d {
+public:
+    explicit LowerConvexHull2d(double epsilon = 1E-8)
+    :   epsilon_(epsilon) { }
+
+    /**
+     * Inserts point into the chain if it is supported. Payloads of points
+     * which are no longer supported are written to removed.
+     * Returns true iff point is supported.
+     */
+    template<typename OutputIterator>
+    bool add_point(const Point& point, T payload, OutputIterator removed);
+
+    unsigned size() const { return chain_.size(); }
+
+    template<typename Function>
+    void for_each(Function function) const {
+        for(auto& entry : chain_) {
+            function(entry.second.payload);
+        }
+    }
+
+private:
+    struct Entry {
+        double y;
+        T payload;
+    };
+
+    using Chain = std::map<double, Entry>;
+
+    Chain chain_;
+    double epsilon_;
+
+    inline bool is_supported(double x, double y) const;
+
+    inline bool below(double left_x, double left_y,
+                      double right_x, double right_y,
+                      double x, double y) const;
+};
+
+/**
+ * Maintains the supported points of a point set in R^d, d >= 3, in the dual
+ * representation of conv(P) + R^d_+: Every supported point p owns the cell
+ * of the weight simplex in which p minimizes the weighted sum. A cell is
+ * stored by its vertices, each with the set of constraints which are tight
+ * at it. Inserting a point only clips the cells in which it is at least as
+ * good as the owner, no linear programs are solved.
+ *
+ * The side tests weight the difference of two points with a compensated dot
+ * product. The vertices of the cells are still rounded, so in contrast to
+ * LowerConvexHull2d the result is only correct up to epsilon.
+ */
+template<typename T>
+class WeightSpaceSubdivision {
+public:
+    WeightSpaceSubdivision(unsigned dimension, double epsilon = 1E-8)
+    :   dimension_(dimension),
+        epsilon_(epsilon),
+        next_id_(dimension) { }
+
+    /**
+     * Inserts point if it is supported. Payloads of points which are no
+     * longer supported are written to removed.
+     * Returns true iff point is supported.
+     */
+    template<typename OutputIterator>
+    bool add_point(const Point& point, T payload, OutputIterator removed);
+
+    unsigned size() const { return cells_.size(); }
+
+    template<typename Function>
+    void for_each(Function function) const {
+        for(auto& cell : cells_) {
+            function(cell.payload);
+        }
+    }
+
+private:
+    struct Vertex {
+        Point weighting;
+        std::vector<unsigned> tight;
+    };
+
+    struct Cell {
+        Point point;
+        T payload;
+        unsigned id;
+        std::vector<Vertex> vertices;
+    };
+
+    unsigned dimension_;
+    double epsilon_;
+
+    // Constraint ids 0, ..., d-1 belong to the weight simplex
+    unsigned next_id_;
+
+    std::list<Cell> cells_;
+
+    inline std::vector<Vertex> initial_cell() const;
+
+    inline bool clip(std::vector<Vertex>& vertices,
+                     const Point& owner,
+                     const Point& other,
+                     unsigned id) const;
+
+    inline bool adjacent(const std::vector<Vertex>& vertices,
+                         unsigned first,
+                         unsigned second,
+                         std::vector<unsigned>& common) const;
+
+    inline bool is_degenerate(const std::vector<Vertex>& vertices) const;
+
+    static inline void add_tight(Vertex& vertex, unsigned id);
+
+    static inline double weighted_difference(const Point& first,
+                                             const Point& second,
+                                             const Point& weighting);
+};
+
+/**
+ * Incremental supported point filter for arbitrary dimension. Dispatches to
+ * LowerConvexHull2d for d = 2 and to WeightSpaceSubdivision otherwise.
+ */
+template<typename T>
+class IncrementalLowerHull {
+public:
+    IncrementalLowerHull(unsigned dimension, double epsilon = 1E-8)
+    :   dimension_(dimension),
+        chain_(epsilon),
+        subdivision_(dimension, epsilon) {
+
+        assert(dimension >= 2);
+    }
+
+    template<typename OutputIterator>
+    bool add_point(const Point& point, T payload, OutputIterator removed) {
+        assert(point.dimension() == dimension_);
+
+        if(dimension_ == 2) {
+            return chain_.add_point(point, payload, removed);
+        } else {
+            return subdivision_.add_point(point, payload, removed);
+        }
+    }
+
+    unsigned size() const {
+        return dimension_ == 2 ? chain_.size() : subdivision_.size();
+    }
+
+    template<typename Function>
+    void for_each(Function function) const {
+        if(dimension_ == 2) {
+            chain_.for_each(function);
+        } else {
+            subdivision_.for_each(function);
+        }
+    }
+
+private:
+    unsigned dimension_;
+    LowerConvexHull2d<T> chain_;
+    WeightSpaceSubdivision<T> subdivision_;
+};
+
+template<typename T>
+inline bool LowerConvexHull2d<T>::
+below(double left_x, double left_y,
+      double right_x, double right_y,
+      double x, double y) const {
+
+    return RobustPredicates::orientation2d(left_x, left_y,
+                                           right_x, right_y,
+                                           x, y) < 0;
+}
+
+template<typename T>
+inline bool LowerConvexHull2d<T>::
+is_supported(double x, double y) const {
+
+    // Weakly dominated by a point of the chain?
+    auto right = chain_.upper_bound(x + epsilon_);
+    if(right != chain_.begin()) {
+        auto left = std::prev(right);
+        if(left->second.y <= y + epsilon_) {
+            return false;
+        }
+
+        // point dominates a point of the chain
+        if(left->first >= x - epsilon_) {
+            return true;
+        }
+    }
+
+    if(right == chain_.end() || right->second.y >= y - epsilon_) {
+        return true;
+    }
+
+    if(right == chain_.begin()) {
+        return true;
+    }
+
+    auto left = std::prev(right);
+
+    return below(left->first, left->second.y,
+                 right->first, right->second.y,
+                 x, y);
+}
+
+template<typename T>
+template<typename OutputIterator>
+bool LowerConvexHull2d<T>::
+add_point(const Point& point, T payload, OutputIterator removed) {
+
+    double x = point[0];
+    double y = point[1];
+
+    if(!is_supported(x, y)) {
+        return false;
+    }
+
+    // Remove all points which are dominated by the new point
+    auto it = chain_.lower_bound(x - epsilon_);
+    while(it != chain_.end() && it->second.y >= y - epsilon_) {
+        *removed++ = it->second.payload;
+        it = chain_.erase(it);
+    }
+
+    auto position = chain_.insert(it, std::make_pair(x, Entry{y, payload}));
+
+    // Restore convexity to the right ...
+    auto right = std::next(position);
+    while(right != chain_.end() && std::next(right) != chain_.end()) {
+        auto next = std::next(right);
+
+        if(below(x, y, next->first, next->second.y, right->first, right->second.y)) {
+            break;
+        }
+
+        *removed++ = right->second.payload;
+        right = chain_.erase(right);
+    }
+
+    // ... and to the left
+    while(position != chain_.begin() && std::prev(position) != chain_.begin()) {
+        auto left = std::prev(position);
+        auto previous = std::prev(left);
+
+        if(below(previous->first, previous->second.y, x, y, left->first, left->second.y)) {
+            break;
+        }
+
+        *removed++ = left->second.payload;
+        chain_.erase(left);
+    }
+
+    return true;
+}
+
+template<typename T>
+inline auto WeightSpaceSubdivision<T>::
+initial_cell() const -> std::vector<Vertex> {
+
+    std::vector<Vertex> vertices(dimension_);
+
+    for(unsigned i = 0; i < dimension_; ++i) {
+        vertices[i].weighting = Point(dimension_);
+        vertices[i].weighting[i] = 1;
+
+        for(unsigned j = 0; j < dimension_; ++j) {
+            if(j != i) {
+                vertices[i].tight.push_back(j);
+            }
+        }
+    }
+
+    return vertices;
+}
+
+template<typename T>
+inline void WeightSpaceSubdivision<T>::
+add_tight(Vertex& vertex, unsigned id) {
+    auto position = std::lower_bound(vertex.tight.begin(), vertex.tight.end(), id);
+    if(position == vertex.tight.end() || *position != id) {
+        vertex.tight.insert(position, id);
+    }
+}
+
+template<typename T>
+inline double WeightSpaceSubdivision<T>::
+weighted_difference(const Point& first,
+                    const Point& second,
+                    const Point& weighting) {
+
+    // Compensated dot product of (first, -second) and (weighting, weighting),
+    // such that the difference of the two points is not rounded before it
+    // is weighted
+    double sum = 0;
+    double error = 0;
+
+    for(unsigned i = 0; i < weighting.dimension(); ++i) {
+        double product, product_error, sum_error;
+
+        RobustPredicates::two_product(first[i], weighting[i], product, product_error);
+        RobustPredicates::two_sum(sum, product, sum, sum_error);
+        error += product_error + sum_error;
+
+        RobustPredicates::two_product(-second[i], weighting[i], product, product_error);
+        RobustPredicates::two_sum(sum, product, sum, sum_error);
+        error += product_error + sum_error;
+    }
+
+    return sum + error;
+}
+
+template<typename T>
+inline bool WeightSpaceSubdivision<T>::
+adjacent(const std::vector<Vertex>& vertices,
+         unsigned first,
+         unsigned second,
+         std::vector<unsigned>& common) const {
+
+    common.clear();
+    std::set_intersection(vertices[first].tight.cbegin(),
+                          vertices[first].tight.cend(),
+                          vertices[second].tight.cbegin(),
+                          vertices[second].tight.cend(),
+                          back_inserter(common));
+
+    if(common.size() + 2 < dimension_) {
+        return false;
+    }
+
+    // Combinatorial test: no third vertex lies on the common face
+    for(unsigned k = 0; k < vertices.size(); ++k) {
+        if(k == first || k == second) {
+            continue;
+        }
+
+        if(std::includes(vertices[k].tight.cbegin(),
+                         vertices[k].tight.cend(),
+                         common.cbegin(),
+                         common.cend())) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename T>
+inline bool WeightSpaceSubdivision<T>::
+is_degenerate(const std::vector<Vertex>& vertices) const {
+
+    if(vertices.size() < dimension_) {
+        return true;
+    }
+
+    // A polytope is lower dimensional iff one of its constraints
+    // is tight at all of its vertices
+    std::vector<unsigned> common = vertices.front().tight;
+    for(auto& vertex : vertices) {
+        std::vector<unsigned> intersection;
+        std::set_intersection(common.cbegin(),
+                              common.cend(),
+                              vertex.tight.cbegin(),
+                              vertex.tight.cend(),
+                              back_inserter(intersection));
+        common.swap(intersection);
+
+        if(common.empty()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename T>
+inline bool WeightSpaceSubdivision<T>::
+clip(std::vector<Vertex>& vertices,
+     const Point& owner,
+     const Point& other,
+     unsigned id) const {
+
+    unsigned size = vertices.size();
+    std::vector<double> distance(size);
+    bool has_outside = false;
+    bool has_inside = false;
+
+    for(unsigned i = 0; i < size; ++i) {
+        distance[i] = weighted_difference(owner, other, vertices[i].weighting);
+
+        if(distance[i] > epsilon_) {
+            has_outside = true;
+        } else if(distance[i] < -epsilon_) {
+            has_inside = true;
+        } else {
+            distance[i] = 0;
+        }
+    }
+
+    if(!has_outside) {
+        for(unsigned i = 0; i < size; ++i) {
+            if(distance[i] == 0) {
+                add_tight(vertices[i], id);
+            }
+        }
+
+        return !is_degenerate(vertices);
+    }
+
+    std::vector<Vertex> clipped;
+    std::vector<unsigned> common;
+
+    for(unsigned i = 0; i < size; ++i) {
+        if(distance[i] > 0) {
+            continue;
+        }
+
+        clipped.push_back(vertices[i]);
+        if(distance[i] == 0) {
+            add_tight(clipped.back(), id);
+        }
+    }
+
+    if(has_inside) {
+        for(unsigned i = 0; i < size; ++i) {
+            if(distance[i] >= 0) {
+                continue;
+            }
+
+            for(unsigned o = 0; o < size; ++o) {
+                if(distance[o] <= 0 || !adjacent(vertices, i, o, common)) {
+                    continue;
+                }
+
+                double alpha = distance[i] / (distance[i] - distance[o]);
+
+                Vertex cut_vertex;
+                cut_vertex.weighting = vertices[o].weighting - vertices[i].weighting;
+                cut_vertex.weighting *= alpha;
+                cut_vertex.weighting += vertices[i].weighting;
+                cut_vertex.tight = common;
+                add_tight(cut_vertex, id);
+
+                clipped.push_back(std::move(cut_vertex));
+            }
+        }
+    }
+
+    vertices.swap(clipped);
+
+    return has_inside && !is_degenerate(vertices);
+}
+
+template<typename T>
+template<typename OutputIterator>
+bool WeightSpaceSubdivision<T>::
+add_point(const Point& point, T payload, OutputIterator removed) {
+
+    if(cells_.empty()) {
+        cells_.push_back(Cell{point, payload, next_id_++, initial_cell()});
+        return true;
+    }
+
+    // The difference between the new point and the lower envelope is
+    // linear on every cell, so it suffices to check the vertices.
+    std::vector<typename std::list<Cell>::iterator> touched_cells;
+    bool supported = false;
+
+    for(auto it = cells_.begin(); it != cells_.end(); ++it) {
+        double minimum = std::numeric_limits<double>::infinity();
+        for(auto& vertex : it->vertices) {
+            minimum = std::min(minimum, weighted_difference(point,
+                                                            it->point,
+                                                            vertex.weighting));
+        }
+
+        if(minimum <= epsilon_) {
+            touched_cells.push_back(it);
+        }
+
+        if(minimum < -epsilon_) {
+            supported = true;
+        }
+    }
+
+    if(!supported) {
+        return false;
+    }
+
+    // Only the touched cells contribute facets to the new cell
+    std::vector<Vertex> vertices = initial_cell();
+    for(auto it : touched_cells) {
+        clip(vertices, point, it->point, it->id);
+    }
+
+    unsigned id = next_id_++;
+
+    for(auto it : touched_cells) {
+        if(!clip(it->vertices, it->point, point, id)) {
+            *removed++ = it->payload;
+            cells_.erase(it);
+        }
+    }
+
+    cells_.push_back(Cell{point, payload, id, std::move(vertices)});
+
+    return true;
+}
+
+}
+
+#endif /* defined(__mco__lower_convex_hull__) */
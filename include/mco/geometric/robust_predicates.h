@@ -0,0 +1,312 @@
+//
+//  robust_predicates.h
+//  mco
+//
+//
+
+#ifndef __mco__robust_predicates__
+#define __mco__robust_predicates__
+
+#include <vector>
+#include <cmath>
+#include <limits>
+
+namespace mco {
+
+/**
+ * Nonoverlapping floating point expansion (Shewchuk). The value of an
+ * expansion is the exact sum of its components, which are sorted by
+ * increasing magnitude.
+ */
+class Expansion {
+public:
+    inline void add(double value);
+
+    inline void add_product(double a, double b);
+
+    inline void add(const Expansion& expansion);
+
+    inline Expansion scaled(double factor) const;
+
+    inline static Expansion product(const Expansion& expansion1,
+                                    const Expansion& expansion2);
+
+    inline int sign() const;
+
+    inline double estimate() const;
+
+    void clear() { components_.clear(); }
+
+private:
+    std::vector<double> components_;
+};
+
+class RobustPredicates {
+public:
+    /**
+     * Computes a + b = x + y exactly, x being the rounded sum.
+     */
+    inline static void two_sum(double a, double b, double& x, double& y);
+
+    /**
+     * Computes a * b = x + y exactly, x being the rounded product.
+     */
+    inline static void two_product(double a, double b, double& x, double& y);
+
+    /**
+     * Returns a value whose sign is the sign of the determinant
+     * | b_x - a_x   c_x - a_x |
+     * | b_y - a_y   c_y - a_y |,
+     * i.e., positive iff a, b, c are in counterclockwise order. The sign
+     * is exact, the floating point result is only refined if the error
+     * bound does not certify it.
+     */
+    inline static double orientation2d(double a_x, double a_y,
+                                       double b_x, double b_y,
+                                       double c_x, double c_y);
+
+    /**
+     * Computes the dot product of a and b as accurately as in twice the
+     * working precision (Ogita, Rump and Oishi).
+     */
+    inline static double dot(const double* a, const double* b, unsigned n);
+
+    /**
+     * Returns the exact sign of the determinant of the square matrix given
+     * by its rows. The determinant is evaluated in floating point first and
+     * only evaluated exactly if the error bound does not certify its sign.
+     */
+    inline static int determinant_sign(const std::vector<std::vector<double>>& rows);
+
+    /**
+     * Floating point determinant of the square matrix given by its rows,
+     * which differs from the exact determinant by at most error_bound.
+     */
+    inline static double determinant(const std::vector<std::vector<double>>& rows,
+                                     double& error_bound);
+
+    inline static Expansion exact_determinant(const std::vector<std::vector<double>>& rows);
+
+    static constexpr double epsilon = std::numeric_limits<double>::epsilon() / 2;
+};
+
+inline void RobustPredicates::
+two_sum(double a, double b, double& x, double& y) {
+    x = a + b;
+    double b_virtual = x - a;
+    double a_virtual = x - b_virtual;
+    double b_roundoff = b - b_virtual;
+    double a_roundoff = a - a_virtual;
+    y = a_roundoff + b_roundoff;
+}
+
+inline void RobustPredicates::
+two_product(double a, double b, double& x, double& y) {
+    x = a * b;
+    y = std::fma(a, b, -x);
+}
+
+inline void Expansion::
+add(double value) {
+    double q = value;
+    unsigned length = 0;
+
+    for(unsigned i = 0; i < components_.size(); ++i) {
+        double h;
+        RobustPredicates::two_sum(q, components_[i], q, h);
+        if(h != 0) {
+            components_[length++] = h;
+        }
+    }
+
+    components_.resize(length);
+    if(q != 0) {
+        components_.push_back(q);
+    }
+}
+
+inline void Expansion::
+add_product(double a, double b) {
+    double x, y;
+    RobustPredicates::two_product(a, b, x, y);
+    add(y);
+    add(x);
+}
+
+inline void Expansion::
+add(const Expansion& expansion) {
+    for(auto component : expansion.components_) {
+        add(component);
+    }
+}
+
+inline Expansion Expansion::
+scaled(double factor) const {
+    Expansion result;
+    for(auto component : components_) {
+        result.add_product(component, factor);
+    }
+    return result;
+}
+
+inline Expansion Expansion::
+product(const Expansion& expansion1, const Expansion& expansion2) {
+    Expansion result;
+    for(auto component : expansion2.components_) {
+        result.add(expansion1.scaled(component));
+    }
+    return result;
+}
+
+inline int Expansion::
+sign() const {
+    if(components_.empty()) {
+        return 0;
+    }
+
+    return components_.back() > 0 ? 1 : -1;
+}
+
+inline double Expansion::
+estimate() const {
+    double sum = 0;
+    for(auto component : components_) {
+        sum += component;
+    }
+    return sum;
+}
+
+inline double RobustPredicates::
+orientation2d(double a_x, double a_y,
+              double b_x, double b_y,
+              double c_x, double c_y) {
+
+    double left = (b_x - a_x) * (c_y - a_y);
+    double right = (b_y - a_y) * (c_x - a_x);
+    double determinant = left - right;
+
+    double error_bound = (3.0 + 16.0 * epsilon) * epsilon
+        * (std::abs(left) + std::abs(right));
+
+    if(determinant > error_bound || -determinant > error_bound) {
+        return determinant;
+    }
+
+    // b_x c_y - b_x a_y - a_x c_y - b_y c_x + b_y a_x + a_y c_x
+    Expansion expansion;
+    expansion.add_product(b_x, c_y);
+    expansion.add_product(-b_x, a_y);
+    expansion.add_product(-a_x, c_y);
+    expansion.add_product(-b_y, c_x);
+    expansion.add_product(b_y, a_x);
+    expansion.add_product(a_y, c_x);
+
+    return expansion.sign() == 0 ? 0.0 : expansion.estimate();
+}
+
+inline double RobustPredicates::
+dot(const double* a, const double* b, unsigned n) {
+    double sum = 0;
+    double error = 0;
+
+    for(unsigned i = 0; i < n; ++i) {
+        double product, product_error, sum_error;
+        two_product(a[i], b[i], product, product_error);
+        two_sum(sum, product, sum, sum_error);
+        error += product_error + sum_error;
+    }
+
+    return sum + error;
+}
+
+inline double RobustPredicates::
+determinant(const std::vector<std::vector<double>>& rows, double& error_bound) {
+    unsigned n = rows.size();
+
+    // The minor of a set of columns and the first rows is expanded along
+    // its last row. The minors of all sets of columns are computed in
+    // increasing order of the sets, so that the minors of the subsets are
+    // known.
+    unsigned sets = 1u << n;
+
+    std::vector<double> minors(sets, 0);
+    std::vector<double> permanents(sets, 0);
+    minors[0] = 1;
+    permanents[0] = 1;
+
+    for(unsigned set = 1; set < sets; ++set) {
+        const std::vector<double>& row = rows[__builtin_popcount(set) - 1];
+
+        unsigned position = __builtin_popcount(set) - 1;
+        for(unsigned column = 0; column < n; ++column) {
+            if(!(set >> column & 1)) {
+                continue;
+            }
+
+            unsigned subset = set & ~(1u << column);
+            double term = row[column] * minors[subset];
+
+            // The sign of the cofactor alternates along the row, starting
+            // with the last column of the set
+            minors[set] += (position % 2 == 0 ? term : -term);
+            permanents[set] += std::abs(row[column]) * permanents[subset];
+            --position;
+        }
+    }
+
+    // Every minor of size k is computed by at most k (k + 3) / 2 rounded
+    // operations on every path, which is doubled for the rounding of the
+    // permanent
+    double operations = n * (n + 3);
+    error_bound = operations * epsilon / (1 - operations * epsilon)
+        * permanents[sets - 1];
+
+    return minors[sets - 1];
+}
+
+inline Expansion RobustPredicates::
+exact_determinant(const std::vector<std::vector<double>>& rows) {
+    unsigned n = rows.size();
+    unsigned sets = 1u << n;
+
+    // Same expansion as in determinant
+    std::vector<Expansion> minors(sets);
+    minors[0].add(1);
+
+    for(unsigned set = 1; set < sets; ++set) {
+        const std::vector<double>& row = rows[__builtin_popcount(set) - 1];
+
+        unsigned position = __builtin_popcount(set) - 1;
+        for(unsigned column = 0; column < n; ++column) {
+            if(!(set >> column & 1)) {
+                continue;
+            }
+
+            unsigned subset = set & ~(1u << column);
+            double factor = position % 2 == 0 ? row[column] : -row[column];
+
+            minors[set].add(minors[subset].scaled(factor));
+            --position;
+        }
+    }
+
+    return minors[sets - 1];
+}
+
+inline int RobustPredicates::
+determinant_sign(const std::vector<std::vector<double>>& rows) {
+    double error_bound;
+    double value = determinant(rows, error_bound);
+
+    if(value > error_bound) {
+        return 1;
+    } else if(-value > error_bound) {
+        return -1;
+    }
+
+    return exact_determinant(rows).sign();
+}
+
+}
+
+#endif /* defined(__mco__robust_predicates__) */
@@ -0,0 +1,218 @@
+//
+//  ep_mapped_label_bags.cpp
+//  mco
+//
+//
+
+#include <mco/ep/basic/ep_mapped_label_bags.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using std::string;
+using std::vector;
+using std::runtime_error;
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using ogdf::Graph;
+using ogdf::node;
+
+namespace mco {
+
+const std::size_t EpMappedLabelBags::resident;
+
+EpMappedLabelBags::
+EpMappedLabelBags(const string& file_name,
+                  std::size_t resident_limit)
+:   file_name_(file_name),
+    resident_limit_(resident_limit) {
+
+    file_ = open(file_name_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+
+    if(file_ < 0) {
+        throw runtime_error("Could not open label file " + file_name_);
+    }
+}
+
+EpMappedLabelBags::
+~EpMappedLabelBags() {
+    unmap();
+    close(file_);
+    unlink(file_name_.c_str());
+}
+
+void EpMappedLabelBags::
+reset(const Graph& graph, unsigned dimension) {
+    dimension_ = dimension;
+
+    resident_bags_.assign(graph.maxNodeIndex() + 1, vector<double>());
+    offsets_.assign(graph.maxNodeIndex() + 1, resident);
+    spilled_values_.assign(graph.maxNodeIndex() + 1, 0);
+    last_use_.assign(graph.maxNodeIndex() + 1, 0);
+
+    clock_ = 0;
+    end_ = 0;
+    garbage_ = 0;
+    resident_values_ = 0;
+    spills_ = 0;
+}
+
+void EpMappedLabelBags::
+add(node n, const Point& cost) {
+    unsigned index = n->index();
+
+    if(offsets_[index] != resident) {
+        page_in(index);
+    }
+
+    vector<double>& bag = resident_bags_[index];
+    bag.insert(bag.end(), cost.cbegin(), cost.cend());
+
+    resident_values_ += dimension_;
+    last_use_[index] = ++clock_;
+
+    if(resident_values_ * sizeof(double) > resident_limit_) {
+        spill();
+    }
+}
+
+EpLabelBags::Bag EpMappedLabelBags::
+bag(node n) {
+    unsigned index = n->index();
+
+    if(offsets_[index] != resident) {
+        return Bag { mapping_ + offsets_[index], spilled_values_[index] / dimension_ };
+    }
+
+    last_use_[index] = ++clock_;
+
+    const vector<double>& bag = resident_bags_[index];
+    return Bag { bag.data(), bag.size() / dimension_ };
+}
+
+void EpMappedLabelBags::
+spill() {
+    vector<unsigned> candidates;
+    for(unsigned index = 0; index < resident_bags_.size(); ++index) {
+        if(!resident_bags_[index].empty()) {
+            candidates.push_back(index);
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [this] (unsigned i, unsigned j) {
+        return last_use_[i] < last_use_[j];
+    });
+
+    for(auto index : candidates) {
+        if(resident_values_ * sizeof(double) <= resident_limit_ / 2) {
+            break;
+        }
+
+        vector<double>& bag = resident_bags_[index];
+
+        reserve(bag.size());
+
+        std::memcpy(mapping_ + end_, bag.data(), bag.size() * sizeof(double));
+        offsets_[index] = end_;
+        spilled_values_[index] = bag.size();
+        end_ += bag.size();
+
+        resident_values_ -= bag.size();
+        vector<double>().swap(bag);
+    }
+
+    // Written pages are left to the file
+    madvise(mapping_, end_ * sizeof(double), MADV_DONTNEED);
+
+    ++spills_;
+}
+
+void EpMappedLabelBags::
+page_in(unsigned index) {
+    const double* segment = mapping_ + offsets_[index];
+
+    resident_bags_[index].assign(segment, segment + spilled_values_[index]);
+    resident_values_ += spilled_values_[index];
+
+    garbage_ += spilled_values_[index];
+    offsets_[index] = resident;
+    spilled_values_[index] = 0;
+}
+
+void EpMappedLabelBags::
+reserve(std::size_t values) {
+    if(garbage_ > 0 && 2 * garbage_ > end_) {
+        compact();
+    }
+
+    if(end_ + values <= capacity_) {
+        return;
+    }
+
+    map(std::max(end_ + values, std::max(2 * capacity_, (std::size_t) 1 << 16)));
+}
+
+void EpMappedLabelBags::
+compact() {
+    vector<unsigned> segments;
+    for(unsigned index = 0; index < offsets_.size(); ++index) {
+        if(offsets_[index] != resident) {
+            segments.push_back(index);
+        }
+    }
+
+    std::sort(segments.begin(), segments.end(), [this] (unsigned i, unsigned j) {
+        return offsets_[i] < offsets_[j];
+    });
+
+    // Segments only move towards the beginning of the file
+    std::size_t end = 0;
+    for(auto index : segments) {
+        std::memmove(mapping_ + end,
+                     mapping_ + offsets_[index],
+                     spilled_values_[index] * sizeof(double));
+
+        offsets_[index] = end;
+        end += spilled_values_[index];
+    }
+
+    end_ = end;
+    garbage_ = 0;
+}
+
+void EpMappedLabelBags::
+map(std::size_t capacity) {
+    unmap();
+
+    if(ftruncate(file_, capacity * sizeof(double)) != 0) {
+        throw runtime_error("Could not resize label file " + file_name_);
+    }
+
+    void* mapping = mmap(nullptr,
+                         capacity * sizeof(double),
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED,
+                         file_,
+                         0);
+
+    if(mapping == MAP_FAILED) {
+        throw runtime_error("Could not map label file " + file_name_);
+    }
+
+    mapping_ = static_cast<double*>(mapping);
+    capacity_ = capacity;
+}
+
+void EpMappedLabelBags::
+unmap() {
+    if(mapping_ != nullptr) {
+        munmap(mapping_, capacity_ * sizeof(double));
+        mapping_ = nullptr;
+    }
+}
+
+}
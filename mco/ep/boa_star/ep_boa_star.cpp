@@ -0,0 +1,166 @@
+//
+//  ep_boa_star.cpp
+//  mco
+//
+//
+
+#include <mco/ep/boa_star/ep_boa_star.h>
+
+#include <queue>
+#include <deque>
+#include <vector>
+#include <list>
+#include <limits>
+
+using std::priority_queue;
+using std::deque;
+using std::vector;
+using std::list;
+using std::pair;
+using std::function;
+using std::numeric_limits;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+using ogdf::edge;
+using ogdf::NodeArray;
+
+#include <mco/basic/point.h>
+#include <mco/ep/basic/dijkstra.h>
+
+namespace mco {
+
+void EpSolverBOAStar::
+Solve(const Graph& graph,
+      function<const Point*(edge)> weights,
+      node source,
+      node target,
+      bool directed) {
+
+    assert(weights(graph.chooseEdge())->dimension() == 2);
+
+    reset_solutions();
+    extracted_labels_ = 0;
+    created_labels_ = 0;
+
+    // Exact distances to the target as consistent heuristic
+    NodeArray<double> h1(graph);
+    NodeArray<double> h2(graph);
+
+    {
+        Dijkstra<double> sssp_solver;
+        NodeArray<edge> predecessor(graph);
+
+        auto mode = directed ? DijkstraModes::Backward : DijkstraModes::Undirected;
+
+        sssp_solver.singleSourceShortestPaths(graph,
+                                              [&weights] (edge e) { return weights(e)->operator[](0); },
+                                              target,
+                                              predecessor,
+                                              h1,
+                                              mode);
+
+        sssp_solver.singleSourceShortestPaths(graph,
+                                              [&weights] (edge e) { return weights(e)->operator[](1); },
+                                              target,
+                                              predecessor,
+                                              h2,
+                                              mode);
+    }
+
+    const double unreachable = numeric_limits<double>::max();
+
+    if(h1[source] == unreachable) {
+        return;
+    }
+
+    NodeArray<double> g2_min(graph, numeric_limits<double>::infinity());
+
+    // Labels are never deleted during the search, so that they can be
+    // predecessors of later labels
+    deque<Label> labels;
+    priority_queue<Label*, vector<Label*>, FValueLexComp> open;
+
+    labels.push_back(Label{0, 0, h1[source], h2[source], source, nullptr, nullptr});
+    open.push(&labels.back());
+    ++created_labels_;
+
+    list<const Label*> target_labels;
+
+    while(!open.empty()) {
+        Label* label = open.top();
+        open.pop();
+
+        node n = label->n;
+
+        if(label->g2 >= g2_min[n] - epsilon_ ||
+           label->f2 >= g2_min[target] - epsilon_) {
+            continue;
+        }
+
+        ++extracted_labels_;
+        g2_min[n] = label->g2;
+
+        if(n == target) {
+            target_labels.push_back(label);
+            continue;
+        }
+
+        for(auto adj : n->adjEdges) {
+            edge e = adj->theEdge();
+
+            if(e->isSelfLoop()) {
+                continue;
+            }
+
+            node v = e->target();
+
+            if(directed) {
+                if(v == n) {
+                    continue;
+                }
+            } else {
+                if(v == n) {
+                    v = e->source();
+                }
+            }
+
+            if(h1[v] == unreachable) {
+                continue;
+            }
+
+            const Point& cost = *weights(e);
+
+            double g2 = label->g2 + cost[1];
+            double f2 = g2 + h2[v];
+
+            if(g2 >= g2_min[v] - epsilon_ ||
+               f2 >= g2_min[target] - epsilon_) {
+                continue;
+            }
+
+            double g1 = label->g1 + cost[0];
+
+            labels.push_back(Label{g1, g2, g1 + h1[v], f2, v, e, label});
+            open.push(&labels.back());
+            ++created_labels_;
+        }
+    }
+
+    list<pair<const list<edge>, const Point>> solutions;
+
+    for(auto label : target_labels) {
+        list<edge> path;
+        for(const Label* current = label; current->pred != nullptr; current = current->pred) {
+            path.push_front(current->e);
+        }
+
+        solutions.push_back(make_pair(path, Point({label->g1, label->g2})));
+    }
+
+    add_solutions(solutions.begin(), solutions.end());
+}
+
+}
@@ -14,6 +14,8 @@
 #include <vector>
 #include <cassert>
 #include <functional>
+#include <algorithm>
+#include <cmath>
 
 using std::queue;
 using std::list;
@@ -177,6 +179,24 @@ bool DominationPartition(const list<const Point *> &source1,
 	return new_labels;
 }
 
+/**
+ * Returns whether covering is at most 1 + tolerance times cost in every
+ * objective.
+ */
+bool IsCovered(const Point& covering,
+               const Point& cost,
+               double tolerance,
+               double epsilon) {
+    
+    for(unsigned i = 0; i < cost.dimension(); ++i) {
+        if(covering[i] - (1 + tolerance) * cost[i] > epsilon) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
 void EpSolverBS::Solve(const Graph& graph,
                        std::function<const Point*(const ogdf::edge)> weights,
                        unsigned dim,
@@ -192,8 +212,52 @@ void EpSolverBS::Solve(const Graph& graph,
 	nodes_in_queue[source] = true;
 
 	labels[source].push_back(Point::Null(dim));
+    
+    std::size_t stored_labels = 1;
+    
+    // Node tolerance of the current step, chosen such that the factors of
+    // all steps at the at most n - 1 edges of a simple path multiply to
+    // 1 + frontier_tolerance
+    double frontier_tolerance = 0;
+    double tolerance = 0;
+    unsigned path_edges = std::max(graph.numberOfNodes() - 1, 1);
+    std::size_t degradation_threshold = label_budget_;
 
 	while(!queue.empty()) {
+        
+        if(stored_labels > degradation_threshold) {
+            double previous_tolerance = frontier_tolerance;
+            frontier_tolerance = frontier_tolerance == 0 ? initial_tolerance_ : 2 * frontier_tolerance;
+            tolerance = std::pow((1 + frontier_tolerance) / (1 + previous_tolerance),
+                                 1.0 / path_edges) - 1;
+            
+            // Every label is merged into an earlier kept label of its node.
+            // The labels of nodes in the queue are all propagated later,
+            // the others have been propagated already.
+            for(auto v : graph.nodes) {
+                auto iter = labels[v].begin();
+                while(iter != labels[v].end()) {
+                    bool covered = false;
+                    
+                    for(auto other = labels[v].begin(); other != iter && !covered; ++other) {
+                        covered = IsCovered(**other, **iter, tolerance, epsilon_);
+                    }
+                    
+                    if(covered) {
+                        delete *iter;
+                        iter = labels[v].erase(iter);
+                        --stored_labels;
+                    } else {
+                        ++iter;
+                    }
+                }
+            }
+            
+            // If merging does not get below the budget, the next step is
+            // taken after the labels grew by another eighth
+            degradation_threshold = std::max(label_budget_, stored_labels + stored_labels / 8);
+        }
+        
 		node n = queue.front();
 
 //		cout << n << ": ";
@@ -232,8 +296,36 @@ void EpSolverBS::Solve(const Graph& graph,
 
 			for(auto &label : currentNodeLabels) {
 				Point * new_label = new Point(*label + *weights(e));
-				new_labels.push_back(new_label);
+                
+                bool covered = false;
+                if(tolerance > 0) {
+                    for(auto other : labels[v]) {
+                        if(IsCovered(*other, *new_label, tolerance, epsilon_)) {
+                            covered = true;
+                            break;
+                        }
+                    }
+                    
+                    for(auto other : new_labels) {
+                        if(covered || IsCovered(*other, *new_label, tolerance, epsilon_)) {
+                            covered = true;
+                            break;
+                        }
+                    }
+                }
+                
+                if(covered) {
+                    delete new_label;
+                } else {
+                    new_labels.push_back(new_label);
+                }
 			}
+            
+            if(new_labels.empty()) {
+                continue;
+            }
+            
+            std::size_t number_of_labels = labels[v].size();
 
 			if(labels[v].empty()) {
 
@@ -263,6 +355,9 @@ void EpSolverBS::Solve(const Graph& graph,
 				}
                 
 			}
+            
+            stored_labels += labels[v].size();
+            stored_labels -= number_of_labels;
 
 		}
 
@@ -289,6 +384,8 @@ void EpSolverBS::Solve(const Graph& graph,
     }
 
 	add_solutions(solutions.begin(), solutions.end());
+    
+    achieved_epsilon_ = frontier_tolerance;
 }
 
 }
@@ -14,6 +14,8 @@
 #include <vector>
 #include <cassert>
 #include <functional>
+#include <algorithm>
+#include <iterator>
 
 using std::queue;
 using std::list;
@@ -22,9 +24,8 @@ using std::cout;
 using std::endl;
 using std::function;
 using std::pair;
+using std::back_inserter;
 
-#include <setoper.h>
-#include <cdd.h>
 #include <ogdf/basic/Graph.h>
 
 using ogdf::edge;
@@ -37,6 +38,8 @@ using ogdf::AdjElement;
 #include <mco/basic/point.h>
 #include <mco/ep/basic/ep_instance.h>
 #include <mco/basic/utility.h>
+#include <mco/geometric/robust_predicates.h>
+#include <mco/geometric/lower_convex_hull.h>
 
 namespace mco {
 
@@ -47,152 +50,90 @@ ConvexHull(const list<const Point *> &source1,
            list<const Point *> &dominated_subset,
            double epsilon) {
     
-//    cout << "new" << endl;
-//    for(auto point : source1) {
-//        cout << *point << endl;
-//    }
-//    cout << "old" << endl;
-//    for(auto point : source2) {
-//        cout << *point << endl;
-//    }
-//    cout << endl;
-    
     unsigned dim = source1.back()->dimension();
-    unsigned no_points = source1.size() + source2.size();
-    
-    if(no_points == 2) {
-        ParetoDominationPointComparator p_cmp;
-        auto point1 = *source1.begin();
-        auto point2 = *source2.begin();
-        
-        if(p_cmp(point1, point2)) {
-            dominated_subset.push_back(point2);
-            nondominated_subset.push_back(point1);
-            return true;
-        } else if(p_cmp(point2, point1)) {
-            dominated_subset.push_back(point1);
-            nondominated_subset.push_back(point2);
-            return false;
-        } else {
-            nondominated_subset.push_back(point1);
-            nondominated_subset.push_back(point2);
-            return true;
-        }
-    }
     
+    // Old points come first, such that they survive ties
+    merged_points_.clear();
+    merged_points_.insert(merged_points_.end(), source2.begin(), source2.end());
+    merged_points_.insert(merged_points_.end(), source1.begin(), source1.end());
     
-    bool changed = false;
-    
-    dd_MatrixPtr points = dd_CreateMatrix(no_points + dim,
-                                          dim + 1);
-    
-    points->representation = dd_Generator;
+    unsigned no_old_points = source2.size();
+    unsigned no_points = merged_points_.size();
     
-    int row_index = 0;
+    vector<bool> supported(no_points, false);
     
-    // Insert extreme rays
-    for(unsigned j = 0; j < dim; ++j) {
+    if(dim == 2) {
         
-        for(unsigned k = 1; k < dim + 1; ++k) {
-            dd_set_d(points->matrix[row_index][k], j + 1 == k ? 1 : 0);
+        // Andrew's monotone chain, lower part only
+        vector<unsigned> order(no_points);
+        for(unsigned i = 0; i < no_points; ++i) {
+            order[i] = i;
         }
         
-        dd_set_d(points->matrix[row_index][0], 0);
+        std::stable_sort(order.begin(), order.end(), [this] (unsigned i, unsigned j) {
+            const Point& p = *merged_points_[i];
+            const Point& q = *merged_points_[j];
+            return p[0] < q[0] || (p[0] == q[0] && p[1] < q[1]);
+        });
         
-        ++row_index;
-    }
-    
-    for(unsigned j = dim; j < no_points + dim; ++j) {
-        dd_set_d(points->matrix[j][dim], 1);
-    }
-    
-    // Insert points from source2 (old points)
-    for(auto pointPtr : source2) {
-        Point point = *pointPtr;
+        hull_indices_.clear();
         
-        for(unsigned k = 1; k < dim + 1; ++k) {
-            dd_set_d(points->matrix[row_index][k], point[k - 1]);
+        for(auto index : order) {
+            const Point& point = *merged_points_[index];
+            
+            if(!hull_indices_.empty() &&
+               point[1] >= (*merged_points_[hull_indices_.back()])[1] - epsilon) {
+                continue;
+            }
+            
+            while(hull_indices_.size() >= 2) {
+                const Point& first = *merged_points_[hull_indices_[hull_indices_.size() - 2]];
+                const Point& second = *merged_points_[hull_indices_.back()];
+                
+                if(RobustPredicates::orientation2d(first[0], first[1],
+                                                   second[0], second[1],
+                                                   point[0], point[1]) > 0) {
+                    break;
+                }
+                
+                hull_indices_.pop_back();
+            }
+            
+            hull_indices_.push_back(index);
         }
         
-        dd_set_d(points->matrix[row_index][0], 1);
+        for(auto index : hull_indices_) {
+            supported[index] = true;
+        }
         
-        ++row_index;
+    } else {
         
-    }
-    
-    dd_ErrorType err;
-    dd_Arow cert = new double[dim + 1][1];
-    
-    // Check all new points for redundancy and insert new non-redundant
-    // points
-    for(auto pointPtr : source1) {
-        Point point = *pointPtr;
+        IncrementalLowerHull<unsigned> hull(dim, hull_epsilon_);
         
-        for(unsigned k = 1; k < dim + 1; ++k) {
-            dd_set_d(points->matrix[row_index][k], point[k - 1]);
+        hull_indices_.clear();
+        for(unsigned i = 0; i < no_points; ++i) {
+            if(hull.add_point(*merged_points_[i], i, back_inserter(hull_indices_))) {
+                supported[i] = true;
+            }
         }
         
-        dd_set_d(points->matrix[row_index][0], 1);
-        
-        if(dd_Redundant(points, row_index + 1, cert, &err)) {
-            dominated_subset.push_back(pointPtr);
-            for(unsigned k = 0; k < dim + 1; ++k) {
-                dd_set_d(points->matrix[row_index][k], k == dim);
-            }
-        } else {
-            nondominated_subset.push_back(pointPtr);
-            ++row_index;
-            changed = true;
+        for(auto index : hull_indices_) {
+            supported[index] = false;
         }
     }
     
-//    dd_WriteMatrix(stdout, points);
-    
-    // If no new point was added, we are done
-    if(!changed) {
-        for(auto pointPtr : source2) {
-            nondominated_subset.push_back(pointPtr);
-        }
-        
-        return changed;
-    }
+    bool changed = false;
     
-    // Now check all old points, if some are now redundant
-    unsigned i = dim;
-    for(auto pointPtr : source2) {
-        Point point = *pointPtr;
-
-        if(dd_Redundant(points, i + 1, cert, &err)) {
-            dominated_subset.push_back(pointPtr);
-            
-            for(unsigned k = 0; k < dim + 1; ++k) {
-                dd_set_d(points->matrix[i][k], k == dim);
-            }
-            
+    for(unsigned i = 0; i < no_points; ++i) {
+        if(supported[i]) {
+            nondominated_subset.push_back(merged_points_[i]);
+            changed = changed || i >= no_old_points;
         } else {
-            nondominated_subset.push_back(pointPtr);
+            dominated_subset.push_back(merged_points_[i]);
         }
-        
-        ++i;
-        
     }
     
-//    dd_WriteMatrix(stdout, points);
-
-    dd_FreeMatrix(points);
-    
-    // FIXME
-//    cout << "dominated" << endl;
-//    for(auto p: dominated_subset) {
-//        cout << *p << endl;
-//    }
-//    cout << "nondominated" << endl;
-//    for(auto p: nondominated_subset) {
-//        cout << *p << endl;
-//    }
-//    cout << endl;
-
-    return true;
+    return changed;
 }
 
 void EpWeightedBS::Solve(const Graph& graph,
@@ -205,8 +146,6 @@ void EpWeightedBS::Solve(const Graph& graph,
 	queue<node> queue;
 	NodeArray<bool> nodes_in_queue(graph, false);
 	NodeArray<list<const Point *>> labels(graph);
-    
-    dd_set_global_constants();
 
 	queue.push(source);
 	nodes_in_queue[source] = true;
@@ -313,8 +252,6 @@ void EpWeightedBS::Solve(const Graph& graph,
     }
     
 	add_solutions(solutions.begin(), solutions.end());
-    
-    dd_free_global_constants();
 }
 
 }
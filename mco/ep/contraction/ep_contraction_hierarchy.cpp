@@ -0,0 +1,748 @@
+//
+//  ep_contraction_hierarchy.cpp
+//  mco
+//
+//
+
+#include <mco/ep/contraction/ep_contraction_hierarchy.h>
+
+#include <list>
+#include <vector>
+#include <map>
+#include <set>
+#include <queue>
+#include <string>
+#include <sstream>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+using std::list;
+using std::vector;
+using std::map;
+using std::set;
+using std::pair;
+using std::make_pair;
+using std::priority_queue;
+using std::greater;
+using std::string;
+using std::stringstream;
+using std::istream;
+using std::ostream;
+using std::function;
+using std::numeric_limits;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+using ogdf::edge;
+
+#include <mco/basic/point.h>
+
+namespace mco {
+
+void EpContractionHierarchy::
+index_graph(const Graph& graph) {
+
+    nodes_.assign(graph.maxNodeIndex() + 1, nullptr);
+    for(auto n : graph.nodes) {
+        nodes_[n->index()] = n;
+    }
+
+    edges_.assign(graph.maxEdgeIndex() + 1, nullptr);
+    for(auto e : graph.edges) {
+        edges_[e->index()] = e;
+    }
+}
+
+void EpContractionHierarchy::
+build(const Graph& graph,
+      function<const Point*(edge)> weights,
+      unsigned dimension,
+      bool directed) {
+
+    dimension_ = dimension;
+    directed_ = directed;
+
+    index_graph(graph);
+
+    unsigned size = nodes_.size();
+
+    entries_.clear();
+    upward_arcs_.assign(size, vector<Arc>());
+    downward_arcs_.assign(size, vector<Arc>());
+    out_bundles_.assign(size, map<unsigned, vector<unsigned>>());
+    in_neighbors_.assign(size, set<unsigned>());
+
+    witness_searches_ = 0;
+    exhausted_witness_searches_ = 0;
+
+    for(auto e : graph.edges) {
+        if(e->isSelfLoop()) {
+            continue;
+        }
+
+        unsigned tail = e->source()->index();
+        unsigned head = e->target()->index();
+
+        entries_.push_back(Entry{*weights(e), e->index(), false, 0, 0, 0});
+        if(!add_entry(tail, head, entries_.size() - 1)) {
+            entries_.pop_back();
+        }
+
+        if(!directed_) {
+            entries_.push_back(Entry{*weights(e), e->index(), true, 0, 0, 0});
+            if(!add_entry(head, tail, entries_.size() - 1)) {
+                entries_.pop_back();
+            }
+        }
+    }
+
+    original_entries_ = entries_.size();
+
+    // Lazy updates: the priority of a node is recomputed when it is at the
+    // top of the queue and the node is put back if it is not minimal anymore
+    vector<unsigned> contracted_neighbors(size, 0);
+    vector<bool> contracted(size, true);
+
+    using QueueEntry = pair<int, unsigned>;
+    priority_queue<QueueEntry, vector<QueueEntry>, greater<QueueEntry>> queue;
+
+    for(auto n : graph.nodes) {
+        contracted[n->index()] = false;
+        queue.push(make_pair(priority(n->index(), contracted_neighbors), n->index()));
+    }
+
+    while(!queue.empty()) {
+        unsigned v = queue.top().second;
+        queue.pop();
+
+        if(contracted[v]) {
+            continue;
+        }
+
+        int current_priority = priority(v, contracted_neighbors);
+        if(!queue.empty() && current_priority > queue.top().first) {
+            queue.push(make_pair(current_priority, v));
+            continue;
+        }
+
+        for(auto& bundle : out_bundles_[v]) {
+            ++contracted_neighbors[bundle.first];
+        }
+
+        for(auto u : in_neighbors_[v]) {
+            if(out_bundles_[v].count(u) == 0) {
+                ++contracted_neighbors[u];
+            }
+        }
+
+        contract(v);
+        contracted[v] = true;
+    }
+
+    out_bundles_.clear();
+    in_neighbors_.clear();
+}
+
+bool EpContractionHierarchy::
+add_entry(unsigned tail, unsigned head, unsigned entry) {
+
+    ComponentwisePointComparator leq(epsilon_, false);
+
+    vector<unsigned>& bundle = out_bundles_[tail][head];
+    const Point& cost = entries_[entry].cost;
+
+    for(auto other : bundle) {
+        if(leq(entries_[other].cost, cost)) {
+            return false;
+        }
+    }
+
+    bundle.erase(std::remove_if(bundle.begin(), bundle.end(),
+                                [this, &leq, &cost] (unsigned other) {
+                                    return leq(cost, entries_[other].cost);
+                                }),
+                 bundle.end());
+
+    bundle.push_back(entry);
+    in_neighbors_[head].insert(tail);
+
+    return true;
+}
+
+int EpContractionHierarchy::
+priority(unsigned v, const vector<unsigned>& contracted_neighbors) const {
+
+    // Edge difference with respect to bundle entries: at most
+    // |B(u, v)| * |B(v, w)| shortcuts for every pair u != w replace the
+    // entries incident to v
+    int in_entries = 0;
+    int out_entries = 0;
+    int cycle_entries = 0;
+
+    for(auto& bundle : out_bundles_[v]) {
+        out_entries += bundle.second.size();
+    }
+
+    for(auto u : in_neighbors_[v]) {
+        int entries = out_bundles_[u].find(v)->second.size();
+        in_entries += entries;
+
+        auto back = out_bundles_[v].find(u);
+        if(back != out_bundles_[v].end()) {
+            cycle_entries += entries * back->second.size();
+        }
+    }
+
+    return in_entries * out_entries - cycle_entries
+        - in_entries - out_entries
+        + contracted_neighbors[v];
+}
+
+void EpContractionHierarchy::
+contract(unsigned v) {
+
+    struct Candidate {
+        unsigned head;
+        Point cost;
+        unsigned first;
+        unsigned second;
+    };
+
+    ComponentwisePointComparator leq(epsilon_, false);
+
+    for(auto u : in_neighbors_[v]) {
+        const vector<unsigned>& first_bundle = out_bundles_[u].find(v)->second;
+
+        vector<Candidate> candidates;
+        Point bound(-numeric_limits<double>::infinity(), dimension_);
+
+        for(auto& second_bundle : out_bundles_[v]) {
+            unsigned w = second_bundle.first;
+            if(w == u) {
+                continue;
+            }
+
+            for(auto first : first_bundle) {
+                for(auto second : second_bundle.second) {
+                    Point cost = entries_[first].cost + entries_[second].cost;
+
+                    for(unsigned i = 0; i < dimension_; ++i) {
+                        bound[i] = std::max(bound[i], cost[i]);
+                    }
+
+                    candidates.push_back(Candidate{w, std::move(cost), first, second});
+                }
+            }
+        }
+
+        if(candidates.empty()) {
+            continue;
+        }
+
+        map<unsigned, vector<Point>> witnesses;
+        witness_search(u, v, bound, witnesses);
+
+        for(auto& candidate : candidates) {
+            bool has_witness = false;
+
+            auto witness_it = witnesses.find(candidate.head);
+            if(witness_it != witnesses.end()) {
+                for(auto& witness : witness_it->second) {
+                    if(leq(witness, candidate.cost)) {
+                        has_witness = true;
+                        break;
+                    }
+                }
+            }
+
+            if(has_witness) {
+                continue;
+            }
+
+            entries_.push_back(Entry{candidate.cost,
+                                     -1,
+                                     false,
+                                     v,
+                                     candidate.first,
+                                     candidate.second});
+
+            if(!add_entry(u, candidate.head, entries_.size() - 1)) {
+                entries_.pop_back();
+            }
+        }
+    }
+
+    // All remaining neighbors of v are contracted after v
+    for(auto& bundle : out_bundles_[v]) {
+        upward_arcs_[v].push_back(Arc{bundle.first, bundle.second});
+        in_neighbors_[bundle.first].erase(v);
+    }
+
+    for(auto u : in_neighbors_[v]) {
+        auto bundle_it = out_bundles_[u].find(v);
+        downward_arcs_[v].push_back(Arc{u, bundle_it->second});
+        out_bundles_[u].erase(bundle_it);
+    }
+
+    out_bundles_[v].clear();
+    in_neighbors_[v].clear();
+}
+
+void EpContractionHierarchy::
+witness_search(unsigned source,
+               unsigned excluded,
+               const Point& bound,
+               map<unsigned, vector<Point>>& witnesses) {
+
+    ++witness_searches_;
+
+    ComponentwisePointComparator leq(epsilon_, false);
+
+    vector<WitnessLabel> labels;
+
+    auto order = [&labels] (unsigned l1, unsigned l2) {
+        return LexPointComparator()(labels[l2].cost, labels[l1].cost);
+    };
+
+    priority_queue<unsigned, vector<unsigned>, decltype(order)> queue(order);
+
+    auto is_dominated = [&leq] (const vector<Point>& bag, const Point& cost) {
+        for(auto& other : bag) {
+            if(leq(other, cost)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    labels.push_back(WitnessLabel{Point(0.0, dimension_), source});
+    queue.push(0);
+
+    unsigned settled_labels = 0;
+
+    while(!queue.empty()) {
+        if(settled_labels >= witness_label_limit_) {
+            // Missing witnesses only lead to superfluous shortcuts
+            ++exhausted_witness_searches_;
+            break;
+        }
+
+        unsigned label = queue.top();
+        queue.pop();
+
+        Point cost = labels[label].cost;
+        unsigned n = labels[label].n;
+
+        vector<Point>& bag = witnesses[n];
+        if(is_dominated(bag, cost)) {
+            continue;
+        }
+
+        bag.push_back(cost);
+        ++settled_labels;
+
+        for(auto& bundle : out_bundles_[n]) {
+            unsigned head = bundle.first;
+            if(head == excluded || head == source) {
+                continue;
+            }
+
+            for(auto entry : bundle.second) {
+                Point next_cost = cost + entries_[entry].cost;
+
+                if(!leq(next_cost, bound)) {
+                    continue;
+                }
+
+                auto witness_it = witnesses.find(head);
+                if(witness_it != witnesses.end() &&
+                   is_dominated(witness_it->second, next_cost)) {
+                    continue;
+                }
+
+                labels.push_back(WitnessLabel{std::move(next_cost), head});
+                queue.push(labels.size() - 1);
+            }
+        }
+    }
+}
+
+void EpContractionHierarchy::
+unpack(unsigned entry, list<edge>& path) const {
+
+    const Entry& current = entries_[entry];
+
+    if(current.edge >= 0) {
+        path.push_back(edges_[current.edge]);
+    } else {
+        unpack(current.first, path);
+        unpack(current.second, path);
+    }
+}
+
+void EpContractionHierarchy::
+write(ostream& stream) const {
+
+    auto precision = stream.precision(numeric_limits<double>::max_digits10);
+
+    stream << "mco-ch " << dimension_ << " " << directed_ << " "
+        << nodes_.size() << " " << edges_.size() << "\n";
+
+    stream << entries_.size() << "\n";
+    for(auto& entry : entries_) {
+        if(entry.edge >= 0) {
+            stream << "e " << entry.edge << " " << entry.reversed;
+        } else {
+            stream << "s " << entry.middle << " " << entry.first << " " << entry.second;
+        }
+
+        for(unsigned i = 0; i < dimension_; ++i) {
+            stream << " " << entry.cost[i];
+        }
+        stream << "\n";
+    }
+
+    unsigned number_of_arcs = 0;
+    for(unsigned v = 0; v < nodes_.size(); ++v) {
+        number_of_arcs += upward_arcs_[v].size() + downward_arcs_[v].size();
+    }
+
+    stream << number_of_arcs << "\n";
+    for(unsigned v = 0; v < nodes_.size(); ++v) {
+        for(auto& arc : upward_arcs_[v]) {
+            stream << "u " << v << " " << arc.head << " " << arc.entries.size();
+            for(auto entry : arc.entries) {
+                stream << " " << entry;
+            }
+            stream << "\n";
+        }
+
+        for(auto& arc : downward_arcs_[v]) {
+            stream << "d " << v << " " << arc.head << " " << arc.entries.size();
+            for(auto entry : arc.entries) {
+                stream << " " << entry;
+            }
+            stream << "\n";
+        }
+    }
+
+    stream.precision(precision);
+}
+
+bool EpContractionHierarchy::
+read(istream& stream, const Graph& graph) {
+
+    string magic;
+    unsigned number_of_nodes, number_of_edges;
+
+    stream >> magic >> dimension_ >> directed_ >> number_of_nodes >> number_of_edges;
+
+    index_graph(graph);
+
+    if(!stream || magic != "mco-ch" ||
+       number_of_nodes != nodes_.size() ||
+       number_of_edges != edges_.size()) {
+        return false;
+    }
+
+    unsigned number_of_entries;
+    stream >> number_of_entries;
+
+    entries_.assign(number_of_entries, Entry{Point(dimension_), -1, false, 0, 0, 0});
+    original_entries_ = 0;
+
+    for(unsigned index = 0; index < number_of_entries; ++index) {
+        Entry& entry = entries_[index];
+
+        string type;
+        stream >> type;
+
+        if(type == "e") {
+            stream >> entry.edge >> entry.reversed;
+
+            if(entry.edge < 0 ||
+               entry.edge >= (int) edges_.size() ||
+               edges_[entry.edge] == nullptr) {
+                return false;
+            }
+
+            ++original_entries_;
+
+        } else if(type == "s") {
+            stream >> entry.middle >> entry.first >> entry.second;
+
+            // Shortcuts are built from entries which exist before them,
+            // so unpacking a shortcut terminates
+            if(entry.middle >= nodes_.size() ||
+               nodes_[entry.middle] == nullptr ||
+               entry.first >= index ||
+               entry.second >= index) {
+                return false;
+            }
+
+        } else {
+            return false;
+        }
+
+        for(unsigned i = 0; i < dimension_; ++i) {
+            stream >> entry.cost[i];
+        }
+
+        if(!stream) {
+            return false;
+        }
+    }
+
+    upward_arcs_.assign(nodes_.size(), vector<Arc>());
+    downward_arcs_.assign(nodes_.size(), vector<Arc>());
+
+    unsigned number_of_arcs;
+    stream >> number_of_arcs;
+
+    for(unsigned i = 0; i < number_of_arcs; ++i) {
+        string type;
+        unsigned v;
+        unsigned size;
+        Arc arc;
+
+        stream >> type >> v >> arc.head >> size;
+
+        if(!stream ||
+           v >= nodes_.size() || nodes_[v] == nullptr ||
+           arc.head >= nodes_.size() || nodes_[arc.head] == nullptr) {
+            return false;
+        }
+
+        arc.entries.resize(size);
+        for(auto& entry : arc.entries) {
+            stream >> entry;
+
+            if(entry >= number_of_entries) {
+                return false;
+            }
+        }
+
+        if(type == "u") {
+            upward_arcs_[v].push_back(std::move(arc));
+        } else if(type == "d") {
+            downward_arcs_[v].push_back(std::move(arc));
+        } else {
+            return false;
+        }
+    }
+
+    witness_searches_ = 0;
+    exhausted_witness_searches_ = 0;
+
+    return !stream.fail();
+}
+
+string EpContractionHierarchy::
+statistics() const {
+
+    unsigned number_of_arcs = 0;
+    unsigned arc_entries = 0;
+    unsigned shortcut_entries = 0;
+
+    for(unsigned v = 0; v < nodes_.size(); ++v) {
+        for(auto arcs : {&upward_arcs_[v], &downward_arcs_[v]}) {
+            for(auto& arc : *arcs) {
+                ++number_of_arcs;
+                arc_entries += arc.entries.size();
+
+                for(auto entry : arc.entries) {
+                    if(entries_[entry].edge < 0) {
+                        ++shortcut_entries;
+                    }
+                }
+            }
+        }
+    }
+
+    stringstream statistics;
+
+    statistics << "Contraction hierarchy: "
+        << number_of_arcs << " arcs with "
+        << arc_entries << " bundle entries ("
+        << shortcut_entries << " shortcuts), "
+        << original_entries_ << " original arcs"
+        << ", witness searches: " << witness_searches_
+        << " (exhausted: " << exhausted_witness_searches_ << ")";
+
+    return statistics.str();
+}
+
+void EpSolverContractionHierarchy::
+Solve(node source, node target) {
+
+    reset_solutions();
+    settled_labels_ = 0;
+
+    unsigned size = hierarchy_.nodes_.size();
+
+    if(forward_bags_.size() != size) {
+        forward_bags_.assign(size, vector<unsigned>());
+        backward_bags_.assign(size, vector<unsigned>());
+        touched_nodes_.clear();
+    }
+
+    for(auto n : touched_nodes_) {
+        forward_bags_[n].clear();
+        backward_bags_[n].clear();
+    }
+
+    touched_nodes_.clear();
+    forward_labels_.clear();
+    backward_labels_.clear();
+
+    list<Candidate> frontier;
+
+    upward_search(target->index(), false, frontier);
+    upward_search(source->index(), true, frontier);
+
+    for(auto& candidate : frontier) {
+        list<unsigned> entries;
+
+        unsigned label = candidate.forward_label;
+        while(forward_labels_[label].pred >= 0) {
+            entries.push_front(forward_labels_[label].entry);
+            label = forward_labels_[label].pred;
+        }
+
+        label = candidate.backward_label;
+        while(backward_labels_[label].pred >= 0) {
+            entries.push_back(backward_labels_[label].entry);
+            label = backward_labels_[label].pred;
+        }
+
+        list<edge> path;
+        for(auto entry : entries) {
+            hierarchy_.unpack(entry, path);
+        }
+
+        add_solution(path, candidate.cost);
+    }
+}
+
+void EpSolverContractionHierarchy::
+upward_search(unsigned root,
+              bool forward,
+              list<Candidate>& frontier) {
+
+    vector<Label>& labels = forward ? forward_labels_ : backward_labels_;
+    vector<vector<unsigned>>& bags = forward ? forward_bags_ : backward_bags_;
+    const vector<vector<EpContractionHierarchy::Arc>>& arcs
+        = forward ? hierarchy_.upward_arcs_ : hierarchy_.downward_arcs_;
+
+    auto order = [&labels] (unsigned l1, unsigned l2) {
+        return LexPointComparator()(labels[l2].cost, labels[l1].cost);
+    };
+
+    priority_queue<unsigned, vector<unsigned>, decltype(order)> queue(order);
+
+    labels.push_back(Label{Point(0.0, hierarchy_.dimension_), root, -1, 0});
+    queue.push(labels.size() - 1);
+
+    while(!queue.empty()) {
+        unsigned label = queue.top();
+        queue.pop();
+
+        Point cost = labels[label].cost;
+        unsigned n = labels[label].n;
+
+        if(is_dominated(cost, bags[n], labels)) {
+            continue;
+        }
+
+        // Completions of the label can only be worse than the
+        // frontier point dominating it
+        if(forward && is_dominated(cost, frontier)) {
+            continue;
+        }
+
+        if(forward_bags_[n].empty() && backward_bags_[n].empty()) {
+            touched_nodes_.push_back(n);
+        }
+
+        bags[n].push_back(label);
+        ++settled_labels_;
+
+        if(forward) {
+            for(auto backward_label : backward_bags_[n]) {
+                add_candidate(cost + backward_labels_[backward_label].cost,
+                              label,
+                              backward_label,
+                              frontier);
+            }
+        }
+
+        for(auto& arc : arcs[n]) {
+            for(auto entry : arc.entries) {
+                Point next_cost = cost + hierarchy_.entries_[entry].cost;
+
+                if(is_dominated(next_cost, bags[arc.head], labels) ||
+                   (forward && is_dominated(next_cost, frontier))) {
+                    continue;
+                }
+
+                labels.push_back(Label{std::move(next_cost), arc.head, (int) label, entry});
+                queue.push(labels.size() - 1);
+            }
+        }
+    }
+}
+
+bool EpSolverContractionHierarchy::
+is_dominated(const Point& cost,
+             const vector<unsigned>& bag,
+             const vector<Label>& labels) const {
+
+    ComponentwisePointComparator leq(epsilon_, false);
+
+    for(auto label : bag) {
+        if(leq(labels[label].cost, cost)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool EpSolverContractionHierarchy::
+is_dominated(const Point& cost,
+             const list<Candidate>& frontier) const {
+
+    ComponentwisePointComparator leq(epsilon_, false);
+
+    for(auto& candidate : frontier) {
+        if(leq(candidate.cost, cost)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void EpSolverContractionHierarchy::
+add_candidate(const Point& cost,
+              unsigned forward_label,
+              unsigned backward_label,
+              list<Candidate>& frontier) const {
+
+    if(is_dominated(cost, frontier)) {
+        return;
+    }
+
+    ComponentwisePointComparator leq(epsilon_, false);
+
+    frontier.remove_if([&leq, &cost] (const Candidate& candidate) {
+        return leq(cost, candidate.cost);
+    });
+
+    frontier.push_back(Candidate{cost, forward_label, backward_label});
+}
+
+}
@@ -11,6 +11,9 @@
 #include <vector>
 #include <set>
 #include <list>
+#include <cmath>
+#include <algorithm>
+#include <iterator>
 
 using std::priority_queue;
 using std::vector;
@@ -28,6 +31,7 @@ using ogdf::edge;
 using ogdf::NodeArray;
 
 #include <mco/basic/point.h>
+#include <mco/basic/local_upper_bounds.h>
 #include <mco/ep/basic/ep_instance.h>
 #include <mco/ep/martins/label.h>
 
@@ -46,34 +50,244 @@ Solve(Graph& graph,
       list<Point> first_phase_bounds,
       bool directed) {
     
-//    using LabelPriorityQueue = priority_queue<Label *, vector<Label *>, HeuristicLexLabelComp>;
-    using LabelPriorityQueue = priority_queue<Label *, vector<Label *>, LexLabelComp>;
-    
     unsigned bound_deletion = 0;
     unsigned heuristic_deletion = 0;
     unsigned first_phase_deletion = 0;
+    unsigned lower_bound_set_deletion = 0;
+    
+    max_queue_size_ = 0;
+    reclaimed_labels_ = 0;
+    peak_label_memory_ = 0;
+    achieved_epsilon_ = 0;
+    
+    // Binary heap of the labels, so that dominated labels can be removed
+    // before they reach the top. The beam search expands the labels in
+    // lexicographic order of their heuristic costs.
+    vector<Label *> lex_min_label;
+    LexLabelComp lex_comp;
+    HeuristicLexLabelComp heuristic_lex_comp(dimension, heuristic);
+    auto queue_comp = [&] (const Label* l1, const Label* l2) {
+        return beam_width_ > 0 ? heuristic_lex_comp(l1, l2) : lex_comp(l1, l2);
+    };
+    unsigned dominated_in_queue = 0;
     
-//	LabelPriorityQueue lex_min_label((HeuristicLexLabelComp(dimension, heuristic)));
-    LabelPriorityQueue lex_min_label((LexLabelComp()));
+    auto push_label = [&] (Label* label) {
+        lex_min_label.push_back(label);
+        std::push_heap(lex_min_label.begin(), lex_min_label.end(), queue_comp);
+    };
     
 	NodeArray<list<Label *>> labels(graph);
     
+    // Costs of reclaimed labels, only used to check dominance
+    EpMemoryLabelBags memory_label_bags;
+    EpLabelBags& reclaimed_costs = label_bags_ != nullptr ? *label_bags_ : memory_label_bags;
+    reclaimed_costs.reset(graph, dimension);
+    
+    const std::size_t label_size = sizeof(Label) + sizeof(Point) + dimension * sizeof(double);
+    std::size_t stored_labels = 0;
+    
+    auto label_memory = [&] () {
+        return stored_labels * label_size + reclaimed_costs.resident_bytes();
+    };
+    
+    auto count_label = [&] () {
+        ++stored_labels;
+        peak_label_memory_ = std::max(peak_label_memory_, label_memory());
+    };
+    
     ComponentwisePointComparator comp_leq(epsilon_, false);
+    
+    // Costs not exceeding the absolute bound are strictly below the
+    // next representable values
+    Point search_region_bound(dimension);
+    for(unsigned i = 0; i < dimension; ++i) {
+        search_region_bound[i] = std::nextafter(absolute_bound[i] + epsilon_,
+                                                numeric_limits<double>::infinity());
+    }
+    
+    LocalUpperBounds upper_bounds(search_region_bound);
+    
+    // Dominated labels which left the queue while other labels still had
+    // them as predecessor. They are freed with their last successor.
+    NodeArray<list<const Label*>> detached_labels(graph);
+    
+    // Drops a reference to the label. Permanent labels without remaining
+    // successors are freed along their predecessors. Labels at the target
+    // and labels in the queue stay alive.
+    auto release = [&] (const Label* label) {
+        while(label != nullptr &&
+              --label->successors == 0 &&
+              !label->in_queue &&
+              label->n != target) {
+            
+            const Label* pred = label->pred;
+            
+            if(label->mark_dominated) {
+                list<const Label*>& node_labels = detached_labels[label->n];
+                node_labels.erase(std::find(node_labels.begin(), node_labels.end(), label));
+            } else {
+                list<Label*>& node_labels = labels[label->n];
+                node_labels.erase(std::find(node_labels.begin(), node_labels.end(), label));
+                
+                reclaimed_costs.add(label->n, *label->point);
+                ++reclaimed_labels_;
+            }
+            
+            delete label;
+            --stored_labels;
+            
+            label = pred;
+        }
+    };
+    
+    // The label has to be removed from its node by the caller. It keeps
+    // its predecessor until it leaves the queue.
+    auto mark_dominated = [&] (Label* label) {
+        label->mark_dominated = true;
+        ++dominated_in_queue;
+    };
+    
+    // Frees a dominated label which left the queue, unless other labels
+    // have it as predecessor
+    auto drop_dominated = [&] (Label* label) {
+        label->in_queue = false;
+        
+        if(label->successors > 0) {
+            detached_labels[label->n].push_back(label);
+            return;
+        }
+        
+        const Label* pred = label->pred;
+        delete label;
+        --stored_labels;
+        release(pred);
+    };
+    
+    // Dominance relaxed by the current node tolerance, which stays 0 as
+    // long as the label budget is kept. A label is merged at most once per
+    // step at every node, so a simple path collects a factor of at most
+    // the product of the node tolerances of all steps at each of its at
+    // most n - 1 edges. The node tolerances are chosen such that this
+    // factor is 1 + frontier_tolerance.
+    double frontier_tolerance = 0;
+    double tolerance = 0;
+    unsigned path_edges = std::max(graph.numberOfNodes() - 1, 1);
+    unsigned degradation_steps = 0;
+    std::size_t degradation_threshold = label_budget_;
+    
+    auto is_covered = [&] (const Point* covering, const Point* cost) {
+        if(tolerance == 0) {
+            return comp_leq(covering, cost);
+        }
+        
+        for(unsigned i = 0; i < dimension; ++i) {
+            if(covering->operator[](i) - (1 + tolerance) * cost->operator[](i) > epsilon_) {
+                return false;
+            }
+        }
+        return true;
+    };
+    
+    unsigned beam_deletion = 0;
+    
+    // Removes the queued label with the smallest crowding distance among
+    // the labels of n if n holds more than beam_width_ labels, including
+    // the reclaimed ones. Labels with successors are kept, since removing
+    // them would not free any memory.
+    auto truncate_beam = [&] (node n) {
+        list<Label*>& node_labels = labels[n];
+        
+        if(node_labels.size() + reclaimed_costs.bag(n).size <= beam_width_) {
+            return;
+        }
+        
+        vector<Label*> beam(node_labels.begin(), node_labels.end());
+        vector<double> crowding(beam.size(), 0);
+        vector<unsigned> order(beam.size());
+        
+        for(unsigned i = 0; i < dimension; ++i) {
+            for(unsigned j = 0; j < beam.size(); ++j) {
+                order[j] = j;
+            }
+            
+            std::sort(order.begin(), order.end(), [&beam, i] (unsigned j, unsigned k) {
+                return beam[j]->point->operator[](i) < beam[k]->point->operator[](i);
+            });
+            
+            double range = beam[order.back()]->point->operator[](i) - beam[order.front()]->point->operator[](i);
+            
+            crowding[order.front()] = numeric_limits<double>::infinity();
+            crowding[order.back()] = numeric_limits<double>::infinity();
+            
+            if(range <= 0) {
+                continue;
+            }
+            
+            for(unsigned j = 1; j + 1 < order.size(); ++j) {
+                crowding[order[j]] += (beam[order[j + 1]]->point->operator[](i) -
+                                       beam[order[j - 1]]->point->operator[](i)) / range;
+            }
+        }
+        
+        Label* removed = nullptr;
+        double min_crowding = numeric_limits<double>::infinity();
+        
+        for(unsigned j = 0; j < beam.size(); ++j) {
+            if(beam[j]->in_queue &&
+               beam[j]->successors == 0 &&
+               (removed == nullptr || crowding[j] < min_crowding)) {
+                removed = beam[j];
+                min_crowding = crowding[j];
+            }
+        }
+        
+        if(removed != nullptr) {
+            node_labels.erase(std::find(node_labels.begin(), node_labels.end(), removed));
+            mark_dominated(removed);
+            ++beam_deletion;
+        }
+    };
+    
+    auto is_reclaimed_dominated = [&] (node n, const Point& cost) {
+        EpLabelBags::Bag bag = reclaimed_costs.bag(n);
+        const double* costs = bag.costs;
+        for(std::size_t i = 0; i < bag.size * dimension; i += dimension) {
+            unsigned j = 0;
+            while(j < dimension && costs[i + j] - (1 + tolerance) * cost[j] <= epsilon_) {
+                ++j;
+            }
+            
+            if(j == dimension) {
+                return true;
+            }
+        }
+        return false;
+    };
 
 	Label *null_label = new Label(Point::Null(dimension), source, nullptr);
     null_label->in_queue = true;
 	labels[source].push_back(null_label);
+    count_label();
+    
+    // Streamed trees start at the null label
+    ++null_label->successors;
     
-	lex_min_label.push(null_label);
+	push_label(null_label);
     
     if(!initial_labels.empty()) {
         construct_labels(labels, initial_labels, absolute_bound);
         
+        stored_labels = 0;
+        for(auto n : graph.nodes) {
+            stored_labels += labels[n].size();
+        }
+        peak_label_memory_ = label_memory();
+        
         for(auto n : graph.nodes) {
             if(n != target && n != source) {
                 
                 for(auto label : labels[n]) {
-                    lex_min_label.push(label);
+                    push_label(label);
                     label->in_queue = true;
                 }
             }
@@ -81,6 +295,10 @@ Solve(Graph& graph,
         
         for(auto label : labels[target]) {
             
+            if(lower_bound_sets_ != nullptr) {
+                upper_bounds.add(*label->point);
+            }
+            
             if(do_value_callback_) {
                 value_callback_(Point(*label->point));
             }
@@ -98,16 +316,192 @@ Solve(Graph& graph,
         }
     }
     
+    unsigned streamed_trees = 0;
+    unsigned streamed_labels = 0;
+    
+    // Seeds the labels of a streamed tree from the source on, so that the
+    // label of the predecessor on the tree path is always known
+    auto seed_tree = [&] (DistanceTree& tree) {
+        NodeArray<Point*>& distance = tree.first;
+        NodeArray<edge>& predecessor = tree.second;
+        
+        NodeArray<list<node>> children(graph);
+        for(auto n : graph.nodes) {
+            edge e = predecessor[n];
+            
+            // Tree edges against their direction do not give paths
+            if(n == source || e == nullptr || (directed && e->target() != n)) {
+                continue;
+            }
+            
+            children[n == e->source() ? e->target() : e->source()].push_back(n);
+        }
+        
+        NodeArray<Label*> tree_labels(graph, nullptr);
+        tree_labels[source] = null_label;
+        ++null_label->successors;
+        
+        list<node> nodes(children[source]);
+        while(!nodes.empty()) {
+            node n = nodes.front();
+            nodes.pop_front();
+            
+            edge e = predecessor[n];
+            Label* pred = tree_labels[n == e->source() ? e->target() : e->source()];
+            const Point* cost = distance[n];
+            
+            if(!comp_leq(*cost, absolute_bound)) {
+                continue;
+            }
+            
+            Label* seed = nullptr;
+            bool dominated = is_reclaimed_dominated(n, *cost);
+            
+            auto iter = labels[n].begin();
+            while(!dominated && iter != labels[n].end()) {
+                Label* label = *iter;
+                
+                if(comp_leq(label->point, cost)) {
+                    // An equal label continues the tree path
+                    if(comp_leq(cost, label->point)) {
+                        seed = label;
+                    }
+                    dominated = true;
+                    break;
+                }
+                
+                if(label->in_queue && comp_leq(cost, label->point)) {
+                    mark_dominated(label);
+                    iter = labels[n].erase(iter);
+                } else {
+                    ++iter;
+                }
+            }
+            
+            if(!dominated) {
+                seed = new Label(new Point(*cost), n, pred);
+                labels[n].push_back(seed);
+                count_label();
+                
+                push_label(seed);
+                seed->in_queue = true;
+                ++streamed_labels;
+                
+                if(n == target && lower_bound_sets_ != nullptr) {
+                    upper_bounds.add(*cost);
+                }
+            }
+            
+            if(seed == nullptr) {
+                continue;
+            }
+            
+            // Pinned, so that releasing labels does not free the
+            // predecessors of the remaining tree nodes
+            tree_labels[n] = seed;
+            ++seed->successors;
+            
+            if(n != target) {
+                nodes.insert(nodes.end(), children[n].begin(), children[n].end());
+            }
+        }
+        
+        for(auto n : graph.nodes) {
+            delete distance[n];
+            release(tree_labels[n]);
+        }
+        
+        ++streamed_trees;
+    };
+    
+    DistanceTree tree;
+    
 	while(!lex_min_label.empty()) {
-		Label *label = lex_min_label.top();
-		lex_min_label.pop();
+        while(tree_stream_(tree)) {
+            seed_tree(tree);
+        }
+        
+        bool merged = stored_labels > degradation_threshold;
+        
+        if(merged) {
+            double previous_tolerance = frontier_tolerance;
+            frontier_tolerance = frontier_tolerance == 0 ? initial_tolerance_ : 2 * frontier_tolerance;
+            tolerance = std::pow((1 + frontier_tolerance) / (1 + previous_tolerance),
+                                 1.0 / path_edges) - 1;
+            ++degradation_steps;
+            
+            // A queued label is merged into an earlier kept or a permanent
+            // label of its node. Merged labels never cover others, so every
+            // label is covered within the current tolerance. Merged labels
+            // which already have successors, e.g., seeded ones, stay alive
+            // until their last successor is freed.
+            for(auto v : graph.nodes) {
+                auto iter = labels[v].begin();
+                while(iter != labels[v].end()) {
+                    Label* label = *iter;
+                    bool covered = false;
+                    
+                    if(label->in_queue) {
+                        for(auto other = labels[v].begin(); other != iter && !covered; ++other) {
+                            covered = is_covered((*other)->point, label->point);
+                        }
+                        
+                        for(auto other = std::next(iter); other != labels[v].end() && !covered; ++other) {
+                            covered = !(*other)->in_queue && is_covered((*other)->point, label->point);
+                        }
+                    }
+                    
+                    if(covered) {
+                        mark_dominated(label);
+                        iter = labels[v].erase(iter);
+                    } else {
+                        ++iter;
+                    }
+                }
+            }
+        }
+        
+        // Dropping the dominated labels once they make up half of the
+        // queue takes amortized constant time per label
+        if(2 * dominated_in_queue > lex_min_label.size()) {
+            unsigned size = 0;
+            for(auto label : lex_min_label) {
+                if(label->mark_dominated) {
+                    drop_dominated(label);
+                } else {
+                    lex_min_label[size++] = label;
+                }
+            }
+            
+            lex_min_label.resize(size);
+            std::make_heap(lex_min_label.begin(), lex_min_label.end(), queue_comp);
+            dominated_in_queue = 0;
+        }
+        
+        // If merging does not get below the budget, the next step is
+        // taken after the labels grew by another eighth
+        if(merged) {
+            degradation_threshold = std::max(label_budget_, stored_labels + stored_labels / 8);
+        }
+        
+        if(lex_min_label.empty()) {
+            break;
+        }
+        
+        max_queue_size_ = std::max(max_queue_size_, (unsigned) lex_min_label.size());
+        
+        std::pop_heap(lex_min_label.begin(), lex_min_label.end(), queue_comp);
+		Label *label = lex_min_label.back();
+		lex_min_label.pop_back();
         assert(label->in_queue);
-        label->in_queue = false;
 
 		if(label->mark_dominated) {
-			delete label;
+            drop_dominated(label);
+            --dominated_in_queue;
 			continue;
 		}
+        
+        label->in_queue = false;
 
 		const Point *label_cost = label->point;
 		node n = label->n;
@@ -132,6 +526,9 @@ Solve(Graph& graph,
         }
 
 //		cout << endl << n << ", " << *label->point << ": ";
+        
+        // Pinned while its extensions are created
+        ++label->successors;
 
 		AdjElement *adj;
 		forall_adj(adj, n) {
@@ -160,6 +557,10 @@ Solve(Graph& graph,
 			const Point *new_cost = new Point(*edge_cost + *label_cost);			// Owner
             
             for(unsigned i = 0; i < dimension; ++i) {
+                if(absolute_bound[i] == numeric_limits<double>::infinity()) {
+                    continue;
+                }
+
                 double heuristic_cost = new_cost->operator[](i) + heuristic(v, i);
                 if(heuristic_cost > absolute_bound[i] + epsilon_) {
                     delete new_cost;
@@ -216,22 +617,29 @@ Solve(Graph& graph,
             if(new_cost == nullptr) {
                 continue;
             }
+            
+            if(lower_bound_sets_ != nullptr &&
+               !lower_bound_sets_->may_improve(v, *new_cost, upper_bounds)) {
+                delete new_cost;
+                ++lower_bound_set_deletion;
+                continue;
+            }
 
-			bool dominated = false;
+			bool dominated = is_reclaimed_dominated(v, *new_cost);
 
 			auto iter = labels[v].begin();
-			while(iter != labels[v].end()) {
+			while(!dominated && iter != labels[v].end()) {
 
 				Label * target_label = *iter;
 
-				if(comp_leq(target_label->point, new_cost)) {
+				if(is_covered(target_label->point, new_cost)) {
 					dominated = true;
 					break;
 				}
 
                 if(target_label->in_queue) {
                     if(comp_leq(new_cost, target_label->point)) {
-                        target_label->mark_dominated = true;
+                        mark_dominated(target_label);
                         iter = labels[v].erase(iter);
                     } else {
                         ++iter;
@@ -248,12 +656,25 @@ Solve(Graph& graph,
 
 			Label * new_label = new Label(new_cost, v, label);
 			labels[v].push_back(new_label);
+            count_label();
 
-			lex_min_label.push(new_label);
+			push_label(new_label);
             new_label->in_queue = true;
+            
+            if(v == target && lower_bound_sets_ != nullptr) {
+                upper_bounds.add(*new_cost);
+            }
+            
+            if(beam_width_ > 0) {
+                truncate_beam(v);
+            }
 		}
-
+        
+        release(label);
 	}
+    
+    final_label_memory_ = label_memory();
+    achieved_epsilon_ = frontier_tolerance;
 
     list<pair<const list<edge>, const Point>> solutions;
     
@@ -264,7 +685,8 @@ Solve(Graph& graph,
             while(curr->n != source) {
                 for(auto adj: curr->n->adjEdges) {
                     edge e = adj->theEdge();
-                    if(e->source() == curr->pred->n && e->target() == curr->n) {
+                    if((e->source() == curr->pred->n && e->target() == curr->n) ||
+                       (!directed && e->target() == curr->pred->n && e->source() == curr->n)) {
                         path.push_back(e);
                         break;
                     }
@@ -294,14 +716,42 @@ Solve(Graph& graph,
 //      cout << *label->point << endl;
 //	}
     
-    cout << "Length bound deletions: " << bound_deletion << endl;
-    cout << "Heuristic bound deletions: " << heuristic_deletion << endl;
-    cout << "First phase bound deletions: " << first_phase_deletion << endl;
+    if(verbose_) {
+        cout << "Length bound deletions: " << bound_deletion << endl;
+        cout << "Heuristic bound deletions: " << heuristic_deletion << endl;
+        cout << "First phase bound deletions: " << first_phase_deletion << endl;
+        
+        if(lower_bound_sets_ != nullptr) {
+            cout << "Lower bound set deletions: " << lower_bound_set_deletion << endl;
+        }
+        
+        cout << "Reclaimed labels: " << reclaimed_labels_ << endl;
+        
+        if(beam_width_ > 0) {
+            cout << "Beam deletions: " << beam_deletion << endl;
+        }
+        
+        if(degradation_steps > 0) {
+            cout << "Label budget exceedances: " << degradation_steps << endl;
+            cout << "Achieved epsilon: " << achieved_epsilon_ << endl;
+        }
+        
+        cout << "Peak label memory (bytes): " << peak_label_memory_ << endl;
+        cout << "Final label memory (bytes): " << final_label_memory_ << endl;
+        
+        if(streamed_trees > 0) {
+            cout << "Streamed trees: " << streamed_trees << endl;
+            cout << "Streamed labels: " << streamed_labels << endl;
+        }
+    }
     
 	node n;
 	forall_nodes(n, graph) {
 		for(auto &label : labels[n])
 			delete label;
+        
+        for(auto label : detached_labels[n])
+            delete label;
 	}
 }
     
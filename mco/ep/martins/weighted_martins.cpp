@@ -12,6 +12,7 @@
 #include <set>
 #include <list>
 #include <iomanip>
+#include <iterator>
 
 using std::priority_queue;
 using std::vector;
@@ -19,6 +20,7 @@ using std::set;
 using std::list;
 using std::function;
 using std::pair;
+using std::back_inserter;
 
 #include <ogdf/basic/Graph.h>
 
@@ -37,140 +39,27 @@ namespace mco {
 bool EpWeightedMartins::NodeEntry::
 add_label(Label& new_label) {
     
-//    cout << "new label:" << endl;
-//    cout << *new_label.point << endl;
-//    cout << "old labels:" << endl;
-//    for(auto label : label_set) {
-//        if(label != nullptr) {
-//            cout << *label->point << endl;
-//        }
-//    }
-//    cout << endl;
+    vector<unsigned> redundant_labels;
     
-    // If hull matrix is not set, set it
-    if(hull_matrix == nullptr) {
-        initialHullMatrix(dimension_, new_label);
-        return true;
+    if(!hull.add_point(*new_label.point,
+                       label_set.size(),
+                       back_inserter(redundant_labels))) {
+        return false;
+    }
     
-    // If there are only two points to compare
-    } else if(head ==  dimension_ + 1) {
-        ComponentwisePointComparator cmp(0, false);
-        auto point1 = *label_set[0]->point;
-        auto point2 = *new_label.point;
-        
-        if(cmp(point1, point2)) {
-            return false;
-        } else if(cmp(point2, point1)) {
-            label_set[0] = &new_label;
-            
-            for(unsigned i = 0; i < dimension_; ++i) {
-                dd_set_d(hull_matrix->matrix[head - 1][i + 1], point2[i]);
-            }
-            dd_set_d(hull_matrix->matrix[head - 1][0], 1.0);
-            
-            return true;
-
-        } else {
-            
-            for(unsigned i = 0; i < dimension_; ++i) {
-                dd_set_d(hull_matrix->matrix[head][i + 1], point2[i]);
-            }
-            dd_set_d(hull_matrix->matrix[head][0], 1.0);
-            
-            label_set[1] = &new_label;
-            
-            ++head;
-            
-            return true;
-        }
-    } else {
-        
-        for(auto label : label_set) {
-            if(label != nullptr) {
-                if(ComponentwisePointComparator()(label->point, new_label.point)) {
-                    return false;
-                }
-            }
-        }
+    label_set.push_back(&new_label);
     
-        // If we have not enough space, extend hull matrix
-        if(hull_matrix->rowsize <= head && free_list.empty()) {
-            extend_hull_matrix();
+    // Permanent labels stay in the label set, labels in the
+    // queue are removed lazily
+    for(auto position : redundant_labels) {
+        Label* label = label_set[position];
+        if(label->in_queue) {
+            label->mark_dominated = true;
+            label_set[position] = nullptr;
         }
-        
-        const Point& new_cost = *new_label.point;
-        
-        // Find position to insert and insert point in hull_matrix at
-        // a free position or at head pointer
-        dd_rowrange position;
-        bool used_free_list = false;
-        if(free_list.empty()) {
-            position = head;
-        } else {
-            position = free_list.front();
-            used_free_list = true;
-        }
-        
-        for(unsigned i = 0; i < dimension_; ++i) {
-            dd_set_d(hull_matrix->matrix[position][i + 1], new_cost[i]);
-        }
-        dd_set_d(hull_matrix->matrix[position][0], 1.0);
-        
-//        dd_WriteMatrix(stdout, hull_matrix);
-        
-        // Check if new point is redundant
-        dd_Arow cert = new double [dimension_ + 1][1];
-        dd_ErrorType err = dd_NoError;
-        if(dd_Redundant(hull_matrix, position + 1, cert, &err)) {
-            
-            for(unsigned i = 0; i < dimension_ + 1; ++i) {
-                dd_set_d(hull_matrix->matrix[position][i], 0.0);
-            }
-            
-            return false;
-        }
-        
-        label_set[position - dimension_] = &new_label;
-        
-        if(used_free_list) {
-            free_list.pop_front();
-        } else {
-            ++head;
-        }
-        
-        // Check if other points are now redundant
-        for(unsigned i = dimension_; i < head; ++i) {
-            Label* label = label_set[i - dimension_];
-            if(label != nullptr && label->in_queue && i != position) {
-                if(dd_Redundant(hull_matrix, i + 1, cert, &err)) {
-                    
-                    for(unsigned j = 0; j < dimension_ + 1; ++j) {
-                        dd_set_d(hull_matrix->matrix[i][j], 0.0);
-                    }
-                    
-                    if(i < head - 1) {
-                        free_list.push_back(i);
-                    } else {
-                        --head;
-                    }
-                 
-                    label->mark_dominated = true;
-                    label_set[i - dimension_] = nullptr;
-                }
-            }
-        }
-        
-//        cout << "new label set:" << endl;
-//        for(auto label : label_set) {
-//            if(label != nullptr) {
-//                cout << *label->point << endl;
-//            }
-//        }
-//        cout << endl;
-//        cout << endl;
-        
-        return true;
     }
+    
+    return true;
 }
     
 void EpWeightedMartins::
@@ -183,10 +72,8 @@ Solve(Graph& graph,
     
     using LabelPriorityQueue = priority_queue<Label *, vector<Label *>, LexLabelComp>;
     
-    dd_set_global_constants();
-    
 	LabelPriorityQueue lex_min_label((LexLabelComp()));
-	NodeArray<NodeEntry> node_entry(graph, dimension);
+	NodeArray<NodeEntry> node_entry(graph, NodeEntry(dimension, hull_epsilon_));
 
 	Label *null_label = new Label(Point::Null(dimension), source, nullptr);
     null_label->in_queue = true;
@@ -255,25 +142,30 @@ Solve(Graph& graph,
     
 	list<pair<const list<edge>, const Point>> solutions;
     
-	for(auto label : node_entry[target].label_set)
-        if(label != nullptr) {
-            list<edge> path;
-            const Label* curr = label;
-            while(curr->n != source) {
-                for(auto adj: curr->n->adjEdges) {
-                    edge e = adj->theEdge();
-                    if(e->source() == curr->pred->n && e->target() == curr->n) {
-                        path.push_back(e);
-                        break;
-                    }
+    // Permanent labels of the target may have become redundant later on,
+    // so only the labels of its hull are reported
+    auto& target_entry = node_entry[target];
+    
+    target_entry.hull.for_each([&] (unsigned position) {
+        const Label* label = target_entry.label_set[position];
+        
+        list<edge> path;
+        const Label* curr = label;
+        while(curr->n != source) {
+            for(auto adj: curr->n->adjEdges) {
+                edge e = adj->theEdge();
+                if(e->source() == curr->pred->n && e->target() == curr->n) {
+                    path.push_back(e);
+                    break;
                 }
-                curr = curr->pred;
             }
-            
-            path.reverse();
-            
-            solutions.push_back(make_pair(path, *label->point));
+            curr = curr->pred;
         }
+        
+        path.reverse();
+        
+        solutions.push_back(make_pair(path, *label->point));
+    });
 
 	reset_solutions();
     
@@ -294,8 +186,6 @@ Solve(Graph& graph,
 		for(auto &label : node_entry[n].label_set)
 			delete label;
 	}
-    
-    dd_free_global_constants();
 }
 
 }
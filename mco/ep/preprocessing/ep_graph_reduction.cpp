@@ -0,0 +1,389 @@
+//
+//  ep_graph_reduction.cpp
+//  mco
+//
+//
+
+#include <mco/ep/preprocessing/ep_graph_reduction.h>
+
+#include <list>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+using std::list;
+using std::vector;
+using std::string;
+using std::stringstream;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+using ogdf::edge;
+using ogdf::NodeArray;
+using ogdf::EdgeArray;
+
+#include <mco/basic/point.h>
+
+namespace mco {
+
+void EpGraphReduction::
+reduce(const Graph& graph,
+       const EdgeArray<Point>& costs,
+       unsigned dimension,
+       node source,
+       node target,
+       const vector<NodeArray<double>>& source_distances,
+       const vector<NodeArray<double>>& target_distances,
+       const Point& bound,
+       bool directed) {
+
+    directed_ = directed;
+
+    reduced_graph_.clear();
+    original_node_.init(reduced_graph_);
+    reduced_costs_.init(reduced_graph_);
+    original_edges_.init(reduced_graph_);
+
+    original_nodes_ = graph.numberOfNodes();
+    original_edges_count_ = graph.numberOfEdges();
+    unreachable_nodes_ = 0;
+    bounded_nodes_ = 0;
+    dead_end_nodes_ = 0;
+    dominated_edges_ = 0;
+    contracted_nodes_ = 0;
+
+    NodeArray<bool> from_source(graph, false);
+    NodeArray<bool> to_target(graph, false);
+
+    reachable_nodes(source, true, from_source);
+    reachable_nodes(target, false, to_target);
+
+    bool use_bound = !source_distances.empty() && !target_distances.empty();
+
+    NodeArray<node> copy(graph, nullptr);
+
+    for(auto n : graph.nodes) {
+        if(n != source && n != target) {
+            if(!from_source[n] || !to_target[n]) {
+                ++unreachable_nodes_;
+                continue;
+            }
+
+            if(use_bound) {
+                bool exceeds_bound = false;
+
+                for(unsigned i = 0; i < dimension; ++i) {
+                    if(source_distances[i][n] + target_distances[i][n] > bound[i] + epsilon_) {
+                        exceeds_bound = true;
+                        break;
+                    }
+                }
+
+                if(exceeds_bound) {
+                    ++bounded_nodes_;
+                    continue;
+                }
+            }
+        }
+
+        node m = reduced_graph_.newNode();
+        copy[n] = m;
+        original_node_[m] = n;
+    }
+
+    source_ = copy[source];
+    target_ = copy[target];
+
+    for(auto e : graph.edges) {
+        node u = copy[e->source()];
+        node w = copy[e->target()];
+
+        if(e->isSelfLoop() || u == nullptr || w == nullptr) {
+            continue;
+        }
+
+        edge f = reduced_graph_.newEdge(u, w);
+        reduced_costs_[f] = costs[e];
+        original_edges_[f].push_back(e);
+    }
+
+    // Parallel edges
+    for(auto n : reduced_graph_.nodes) {
+        vector<node> neighbors;
+        for(auto adj : n->adjEdges) {
+            edge e = adj->theEdge();
+            node neighbor = e->opposite(n);
+
+            if(directed_ ? e->source() == n : n->index() < neighbor->index()) {
+                neighbors.push_back(neighbor);
+            }
+        }
+
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                        neighbors.end());
+
+        for(auto neighbor : neighbors) {
+            remove_dominated_parallel_edges(n, neighbor);
+        }
+    }
+
+    // Dead ends and degree-2 chains. No nodes are created from here on, so
+    // node indices stay valid.
+    vector<node> nodes_by_index(reduced_graph_.maxNodeIndex() + 1, nullptr);
+    vector<bool> in_queue(nodes_by_index.size(), true);
+    list<int> queue;
+
+    for(auto n : reduced_graph_.nodes) {
+        nodes_by_index[n->index()] = n;
+        queue.push_back(n->index());
+    }
+
+    while(!queue.empty()) {
+        int index = queue.front();
+        queue.pop_front();
+        in_queue[index] = false;
+
+        node n = nodes_by_index[index];
+        if(n == nullptr || n == source_ || n == target_) {
+            continue;
+        }
+
+        list<node> touched_nodes;
+
+        if(is_dead_end(n)) {
+            for(auto adj : n->adjEdges) {
+                touched_nodes.push_back(adj->theEdge()->opposite(n));
+            }
+
+            reduced_graph_.delNode(n);
+            ++dead_end_nodes_;
+
+        } else if(contract(n, touched_nodes)) {
+            ++contracted_nodes_;
+
+        } else {
+            continue;
+        }
+
+        nodes_by_index[index] = nullptr;
+
+        for(auto m : touched_nodes) {
+            if(!in_queue[m->index()]) {
+                queue.push_back(m->index());
+                in_queue[m->index()] = true;
+            }
+        }
+    }
+}
+
+void EpGraphReduction::
+reachable_nodes(node root,
+                bool forward,
+                NodeArray<bool>& reached) const {
+
+    list<node> queue;
+    queue.push_back(root);
+    reached[root] = true;
+
+    while(!queue.empty()) {
+        node n = queue.front();
+        queue.pop_front();
+
+        for(auto adj : n->adjEdges) {
+            edge e = adj->theEdge();
+
+            if(e->isSelfLoop()) {
+                continue;
+            }
+
+            if(directed_ && (forward ? e->source() : e->target()) != n) {
+                continue;
+            }
+
+            node v = e->opposite(n);
+            if(!reached[v]) {
+                reached[v] = true;
+                queue.push_back(v);
+            }
+        }
+    }
+}
+
+bool EpGraphReduction::
+remove_dominated_parallel_edges(node n, node neighbor) {
+
+    vector<edge> parallel_edges;
+    for(auto adj : n->adjEdges) {
+        edge e = adj->theEdge();
+
+        if(e->opposite(n) == neighbor && (!directed_ || e->source() == n)) {
+            parallel_edges.push_back(e);
+        }
+    }
+
+    ComponentwisePointComparator leq(epsilon_, false);
+
+    vector<bool> dominated(parallel_edges.size(), false);
+    bool changed = false;
+
+    for(unsigned i = 0; i < parallel_edges.size(); ++i) {
+        for(unsigned j = 0; j < parallel_edges.size() && !dominated[i]; ++j) {
+            if(i != j && !dominated[j] &&
+               leq(reduced_costs_[parallel_edges[j]], reduced_costs_[parallel_edges[i]])) {
+                dominated[i] = true;
+            }
+        }
+    }
+
+    for(unsigned i = 0; i < parallel_edges.size(); ++i) {
+        if(dominated[i]) {
+            reduced_graph_.delEdge(parallel_edges[i]);
+            ++dominated_edges_;
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+bool EpGraphReduction::
+is_dead_end(node n) const {
+
+    // A simple path through n needs two different neighbors,
+    // one in front of n and one behind it
+    node in_neighbor = nullptr;
+    node out_neighbor = nullptr;
+
+    for(auto adj : n->adjEdges) {
+        edge e = adj->theEdge();
+        node neighbor = e->opposite(n);
+
+        if(!directed_ || e->target() == n) {
+            if(in_neighbor != nullptr && in_neighbor != neighbor) {
+                in_neighbor = n;
+            } else if(in_neighbor == nullptr) {
+                in_neighbor = neighbor;
+            }
+        }
+
+        if(!directed_ || e->source() == n) {
+            if(out_neighbor != nullptr && out_neighbor != neighbor) {
+                out_neighbor = n;
+            } else if(out_neighbor == nullptr) {
+                out_neighbor = neighbor;
+            }
+        }
+    }
+
+    // n stands for "more than one neighbor"
+    return in_neighbor == nullptr ||
+        out_neighbor == nullptr ||
+        (in_neighbor == out_neighbor && in_neighbor != n);
+}
+
+bool EpGraphReduction::
+contract(node n, list<node>& touched_nodes) {
+
+    edge in_edge = nullptr;
+    edge out_edge = nullptr;
+
+    if(directed_) {
+        if(n->indeg() != 1 || n->outdeg() != 1) {
+            return false;
+        }
+
+        for(auto adj : n->adjEdges) {
+            edge e = adj->theEdge();
+            if(e->target() == n) {
+                in_edge = e;
+            } else {
+                out_edge = e;
+            }
+        }
+
+    } else {
+        if(n->degree() != 2) {
+            return false;
+        }
+
+        for(auto adj : n->adjEdges) {
+            if(in_edge == nullptr) {
+                in_edge = adj->theEdge();
+            } else {
+                out_edge = adj->theEdge();
+            }
+        }
+    }
+
+    node u = in_edge->opposite(n);
+    node w = out_edge->opposite(n);
+
+    if(u == w) {
+        return false;
+    }
+
+    list<edge> path;
+    append_edges(in_edge, u, path);
+    append_edges(out_edge, n, path);
+
+    edge shortcut = reduced_graph_.newEdge(u, w);
+    reduced_costs_[shortcut] = reduced_costs_[in_edge] + reduced_costs_[out_edge];
+    original_edges_[shortcut] = path;
+
+    reduced_graph_.delNode(n);
+
+    remove_dominated_parallel_edges(u, w);
+
+    touched_nodes.push_back(u);
+    touched_nodes.push_back(w);
+
+    return true;
+}
+
+void EpGraphReduction::
+append_edges(edge e, node from, list<edge>& path) const {
+
+    const list<edge>& edges = original_edges_[e];
+
+    if(e->source() == from) {
+        path.insert(path.end(), edges.begin(), edges.end());
+    } else {
+        path.insert(path.end(), edges.rbegin(), edges.rend());
+    }
+}
+
+list<edge> EpGraphReduction::
+original_path(const list<edge>& path) const {
+
+    list<edge> result;
+    node current = source_;
+
+    for(auto e : path) {
+        append_edges(e, current, result);
+        current = e->opposite(current);
+    }
+
+    return result;
+}
+
+string EpGraphReduction::
+statistics() const {
+    stringstream statistics;
+
+    statistics << "Graph reduction: "
+        << original_nodes_ << " -> " << reduced_graph_.numberOfNodes() << " nodes, "
+        << original_edges_count_ << " -> " << reduced_graph_.numberOfEdges() << " edges"
+        << " (unreachable nodes: " << unreachable_nodes_
+        << ", bounded nodes: " << bounded_nodes_
+        << ", dead ends: " << dead_end_nodes_
+        << ", contracted nodes: " << contracted_nodes_
+        << ", dominated edges: " << dominated_edges_ << ")";
+
+    return statistics.str();
+}
+
+}
@@ -0,0 +1,185 @@
+//
+//  ep_landmarks.cpp
+//  mco
+//
+//
+
+#include <mco/ep/preprocessing/ep_landmarks.h>
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+using std::vector;
+using std::function;
+using std::numeric_limits;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+using ogdf::edge;
+using ogdf::NodeArray;
+
+#include <mco/basic/point.h>
+#include <mco/ep/basic/dijkstra.h>
+
+namespace mco {
+
+void EpLandmarks::
+compute(const Graph& graph,
+        function<const Point*(edge)> weights,
+        unsigned dimension,
+        bool directed) {
+
+    dimension_ = dimension;
+    directed_ = directed;
+
+    unsigned number_of_landmarks = std::min(number_of_landmarks_,
+                                            (unsigned) graph.numberOfNodes());
+    unsigned size = (graph.maxNodeIndex() + 1) * number_of_landmarks * dimension_;
+
+    landmarks_.assign(number_of_landmarks, nullptr);
+    distances_from_landmarks_.assign(size, numeric_limits<double>::infinity());
+
+    if(directed_) {
+        distances_to_landmarks_.assign(size, numeric_limits<double>::infinity());
+    } else {
+        distances_to_landmarks_.clear();
+    }
+
+    if(number_of_landmarks == 0) {
+        return;
+    }
+
+    // Farthest-point selection: the next landmark is the node with the
+    // largest distance (sum over all objectives) to its nearest landmark.
+    // Nodes not reached from any landmark yet are preferred, so that every
+    // connected component gets a landmark. The first landmark is the node
+    // farthest from an arbitrary node.
+    NodeArray<double> separation(graph, numeric_limits<double>::infinity());
+
+    auto farthest_node = [&graph, &separation] () {
+        node farthest = graph.firstNode();
+        for(auto n : graph.nodes) {
+            if(separation[n] > separation[farthest]) {
+                farthest = n;
+            }
+        }
+        return farthest;
+    };
+
+    auto separate = [this, &graph, &separation] (unsigned landmark_index, bool reset) {
+        unsigned stride = landmarks_.size() * dimension_;
+
+        for(auto n : graph.nodes) {
+            const double* distances
+                = &distances_from_landmarks_[n->index() * stride + landmark_index * dimension_];
+
+            double distance = 0;
+            for(unsigned i = 0; i < dimension_; ++i) {
+                distance += distances[i];
+            }
+
+            if(reset || distance < separation[n]) {
+                separation[n] = distance;
+            }
+        }
+    };
+
+    landmark_distances(graph, weights, graph.firstNode(), 0, false);
+    separate(0, true);
+
+    for(unsigned i = 0; i < number_of_landmarks; ++i) {
+        landmarks_[i] = farthest_node();
+
+        landmark_distances(graph, weights, landmarks_[i], i, false);
+
+        if(directed_) {
+            landmark_distances(graph, weights, landmarks_[i], i, true);
+        }
+
+        separate(i, i == 0);
+    }
+}
+
+function<double(node, unsigned)> EpLandmarks::
+heuristic(node target) const {
+
+    if(landmarks_.empty()) {
+        return [] (node, unsigned) { return 0.0; };
+    }
+
+    unsigned stride = landmarks_.size() * dimension_;
+    unsigned offset = target->index() * stride;
+
+    vector<double> from_target(distances_from_landmarks_.begin() + offset,
+                               distances_from_landmarks_.begin() + offset + stride);
+
+    vector<double> to_target;
+    if(directed_) {
+        to_target.assign(distances_to_landmarks_.begin() + offset,
+                         distances_to_landmarks_.begin() + offset + stride);
+    }
+
+    return [this, stride, from_target, to_target] (node n, unsigned objective) {
+        const double* to_n = nullptr;
+        if(directed_) {
+            to_n = &distances_to_landmarks_[n->index() * stride];
+        }
+
+        return lower_bound(&distances_from_landmarks_[n->index() * stride],
+                           to_n,
+                           from_target.data(),
+                           to_target.data(),
+                           objective);
+    };
+}
+
+void EpLandmarks::
+landmark_distances(const Graph& graph,
+                   function<const Point*(edge)> weights,
+                   node landmark,
+                   unsigned landmark_index,
+                   bool to_landmark) {
+
+    Dijkstra<double> sssp_solver;
+
+    NodeArray<double> distance(graph);
+    NodeArray<edge> predecessor(graph);
+
+    auto mode = DijkstraModes::Undirected;
+    if(directed_) {
+        mode = to_landmark ? DijkstraModes::Backward : DijkstraModes::Forward;
+    }
+
+    vector<double>& distances = to_landmark ? distances_to_landmarks_ : distances_from_landmarks_;
+    unsigned stride = landmarks_.size() * dimension_;
+
+    for(unsigned i = 0; i < dimension_; ++i) {
+        auto length = [&weights, i] (edge e) {
+            return weights(e)->operator[](i);
+        };
+
+        sssp_solver.singleSourceShortestPaths(graph,
+                                              length,
+                                              landmark,
+                                              predecessor,
+                                              distance,
+                                              mode);
+
+        for(auto n : graph.nodes) {
+            double value = distance[n];
+
+            // Dijkstra marks unreachable nodes by the maximal value
+            if(value >= numeric_limits<double>::max()) {
+                value = numeric_limits<double>::infinity();
+            }
+
+            distances[n->index() * stride + landmark_index * dimension_ + i] = value;
+        }
+    }
+}
+
+}
@@ -0,0 +1,101 @@
+//
+//  ep_lower_bound_sets.cpp
+//  mco
+//
+//
+
+#include <mco/ep/preprocessing/ep_lower_bound_sets.h>
+
+#include <vector>
+#include <limits>
+#include <functional>
+
+using std::vector;
+using std::function;
+using std::numeric_limits;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+using ogdf::edge;
+using ogdf::NodeArray;
+
+#include <mco/basic/point.h>
+#include <mco/ep/dual_benson/ep_dual_benson.h>
+
+namespace mco {
+
+void EpLowerBoundSets::
+compute(const Graph& graph,
+        function<const Point*(edge)> weights,
+        node source,
+        node target) {
+
+    dimension_ = weights(graph.chooseEdge())->dimension();
+
+    unsigned size = graph.maxNodeIndex() + 1;
+
+    weightings_.clear();
+    vector<vector<double>> right_hand_sides;
+
+    auto callback = [&] (const Point& weighting,
+                         NodeArray<Point*>& distances,
+                         NodeArray<edge>&) {
+
+        // The last component is computed as 1 minus the others and can be
+        // slightly negative, which would turn unbounded objectives of the
+        // upper bounds into -infinity
+        Point clamped_weighting(weighting);
+        for(unsigned i = 0; i < dimension_; ++i) {
+            if(clamped_weighting[i] < 0) {
+                clamped_weighting[i] = 0;
+            }
+        }
+
+        weightings_.push_back(std::move(clamped_weighting));
+
+        vector<double> values(size, numeric_limits<double>::infinity());
+        for(auto n : graph.nodes) {
+            double value = distances[n]->operator[](0);
+
+            // Dijkstra marks unreachable nodes by the maximal value
+            if(value < numeric_limits<double>::max()) {
+                values[n->index()] = value;
+            }
+        }
+
+        right_hand_sides.push_back(std::move(values));
+    };
+
+    // The trees are rooted at the target, the weightings explored are the
+    // ones of the source-target problem
+    EPDualBensonSolver<> first_phase(epsilon_);
+    first_phase.set_weighted_callback(callback);
+    first_phase.Solve(graph, weights, target, source);
+
+    unsigned number_of_weightings = weightings_.size();
+
+    right_hand_sides_.assign(size * number_of_weightings, 0);
+    ideal_points_.assign(size * dimension_, 0);
+
+    for(unsigned k = 0; k < number_of_weightings; ++k) {
+        int unit_objective = -1;
+        for(unsigned i = 0; i < dimension_; ++i) {
+            if(weightings_[k][i] > 1 - epsilon_) {
+                unit_objective = i;
+            }
+        }
+
+        for(unsigned index = 0; index < size; ++index) {
+            right_hand_sides_[index * number_of_weightings + k] = right_hand_sides[k][index];
+
+            if(unit_objective >= 0) {
+                double& ideal = ideal_points_[index * dimension_ + unit_objective];
+                ideal = std::max(ideal, right_hand_sides[k][index]);
+            }
+        }
+    }
+}
+
+}
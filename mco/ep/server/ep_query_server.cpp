@@ -0,0 +1,172 @@
+//
+//  ep_query_server.cpp
+//  mco
+//
+//
+
+#include <mco/ep/server/ep_query_server.h>
+
+#include <list>
+#include <string>
+#include <sstream>
+#include <mutex>
+#include <limits>
+#include <functional>
+
+using std::list;
+using std::string;
+using std::stringstream;
+using std::istringstream;
+using std::istream;
+using std::ostream;
+using std::mutex;
+using std::lock_guard;
+using std::function;
+using std::numeric_limits;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::EdgeArray;
+using ogdf::node;
+using ogdf::edge;
+
+namespace mco {
+
+EpQueryServer::
+EpQueryServer(Graph& graph,
+              const EdgeArray<Point>& costs,
+              unsigned dimension,
+              bool directed,
+              double epsilon,
+              const EpLandmarks& landmarks,
+              const EpContractionHierarchy* hierarchy,
+              unsigned number_of_workers)
+:   graph_(graph),
+    costs_(costs),
+    dimension_(dimension),
+    directed_(directed),
+    landmarks_(landmarks) {
+
+    // Nodes are addressed by their ids in the instance file
+    nodes_.assign(graph_.maxNodeIndex() + 1, nullptr);
+    for(auto n : graph_.nodes) {
+        nodes_[n->index()] = n;
+    }
+
+    for(unsigned i = 0; i < number_of_workers; ++i) {
+        martins_solvers_.emplace_back(new EpSolverMartins(epsilon));
+        martins_solvers_.back()->set_verbose(false);
+
+        if(hierarchy != nullptr) {
+            hierarchy_solvers_.emplace_back(new EpSolverContractionHierarchy(*hierarchy,
+                                                                             epsilon));
+        }
+    }
+}
+
+string EpQueryServer::
+answer(const string& query, unsigned worker) {
+    istringstream query_stream(query);
+
+    unsigned source_id, target_id;
+    query_stream >> source_id >> target_id;
+
+    if(!query_stream ||
+       source_id >= nodes_.size() || nodes_[source_id] == nullptr ||
+       target_id >= nodes_.size() || nodes_[target_id] == nullptr) {
+        return "error: unknown source or target\n";
+    }
+
+    node source = nodes_[source_id];
+    node target = nodes_[target_id];
+
+    Point bounds(numeric_limits<double>::infinity(), dimension_);
+    bool is_bounded = false;
+
+    unsigned number_of_bounds = 0;
+    string bound;
+    while(query_stream >> bound) {
+        if(number_of_bounds == dimension_) {
+            return "error: too many bounds\n";
+        }
+
+        try {
+            bounds[number_of_bounds] = std::stod(bound);
+        } catch(std::exception&) {
+            return "error: invalid bound " + bound + "\n";
+        }
+
+        is_bounded = is_bounded || bounds[number_of_bounds] < numeric_limits<double>::infinity();
+        ++number_of_bounds;
+    }
+
+    const list<std::pair<const list<edge>, const Point>>* solutions;
+
+    if(!is_bounded && !hierarchy_solvers_.empty()) {
+        EpSolverContractionHierarchy& solver = *hierarchy_solvers_[worker];
+        solver.Solve(source, target);
+        solutions = &solver.solutions();
+
+    } else {
+        EpSolverMartins& solver = *martins_solvers_[worker];
+
+        auto cost_function = [this] (edge e) { return &costs_[e]; };
+
+        function<double(node, unsigned)> heuristic = [] (node, unsigned) { return 0.0; };
+        if(is_bounded) {
+            heuristic = landmarks_.heuristic(target);
+        }
+
+        solver.Solve(graph_,
+                     cost_function,
+                     dimension_,
+                     source,
+                     target,
+                     bounds,
+                     heuristic,
+                     list<Point>(),
+                     directed_);
+
+        solutions = &solver.solutions();
+    }
+
+    stringstream response;
+    response.precision(numeric_limits<double>::max_digits10);
+
+    response << solutions->size() << " points\n";
+    for(auto& solution : *solutions) {
+        for(unsigned i = 0; i < dimension_; ++i) {
+            response << (i > 0 ? " " : "") << solution.second[i];
+        }
+        response << "\n";
+    }
+
+    return response.str();
+}
+
+void EpQueryServer::
+serve_stream(istream& input, ostream& output, ThreadPool& pool) {
+    mutex output_mutex;
+    unsigned query_id = 0;
+
+    string query;
+    while(std::getline(input, query)) {
+        if(query.empty() || query[0] == '#') {
+            continue;
+        }
+
+        unsigned id = query_id++;
+
+        pool.submit([this, query, id, &output, &output_mutex] (unsigned worker) {
+            string response = answer(query, worker);
+
+            lock_guard<mutex> lock(output_mutex);
+            output << "query " << id << ": " << response << std::flush;
+        });
+    }
+
+    pool.wait();
+}
+
+}
@@ -0,0 +1,226 @@
+//
+//  ep_solver_tmda.cpp
+//  mco
+//
+//
+
+#include <mco/ep/tmda/ep_solver_tmda.h>
+
+#include <set>
+#include <vector>
+#include <list>
+
+using std::set;
+using std::vector;
+using std::list;
+using std::pair;
+using std::function;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+using ogdf::edge;
+using ogdf::NodeArray;
+using ogdf::EdgeArray;
+
+#include <mco/basic/point.h>
+#include <mco/basic/componentwise_point_comparator.h>
+
+namespace mco {
+
+void EpSolverTMDA::
+Solve(const Graph& graph,
+      function<const Point*(edge)> weights,
+      unsigned dimension,
+      node source,
+      node target,
+      bool directed) {
+
+    reset_solutions();
+    max_queue_size_ = 0;
+    max_stored_labels_ = 0;
+    created_labels_ = 0;
+
+    ComponentwisePointComparator comp_leq(epsilon_, false);
+    LexPointComparator lex_le;
+
+    NodeArray<vector<Label*>> permanent_labels(graph);
+    unsigned number_of_permanent_labels = 0;
+
+    set<Label*, LabelLexComp> queue;
+    NodeArray<Label*> queued_label(graph, nullptr);
+
+    // Index of the next permanent label of the tail to be considered for
+    // the arc source -> target (forward) and target -> source (backward)
+    EdgeArray<unsigned> forward_index(graph, 0);
+    EdgeArray<unsigned> backward_index(graph, 0);
+
+    // Weak dominance by the node's or the target's permanent labels. Since
+    // costs are non-negative, a label dominated by a target label cannot be
+    // extended to a new point.
+    auto is_dominated = [&] (const Point& cost, node n) {
+        for(auto label : permanent_labels[n]) {
+            if(comp_leq(label->cost, cost)) {
+                return true;
+            }
+        }
+
+        if(n != target) {
+            for(auto label : permanent_labels[target]) {
+                if(comp_leq(label->cost, cost)) {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    };
+
+    auto push = [&] (Label* label) {
+        queue.insert(label);
+        queued_label[label->n] = label;
+        ++created_labels_;
+
+        max_queue_size_ = std::max(max_queue_size_, (unsigned) queue.size());
+        max_stored_labels_ = std::max(max_stored_labels_,
+                                      (unsigned) queue.size() + number_of_permanent_labels);
+    };
+
+    // Lexicographically smallest non-dominated label over all incoming arcs
+    auto next_candidate = [&] (node n) {
+        Point best_cost;
+        edge best_edge = nullptr;
+        const Label* best_pred = nullptr;
+
+        for(auto adj : n->adjEdges) {
+            edge e = adj->theEdge();
+
+            if(e->isSelfLoop()) {
+                continue;
+            }
+
+            node tail;
+            unsigned* index;
+
+            if(e->target() == n) {
+                tail = e->source();
+                index = &forward_index[e];
+            } else if(!directed) {
+                tail = e->target();
+                index = &backward_index[e];
+            } else {
+                continue;
+            }
+
+            const Point& edge_cost = *weights(e);
+            auto& tail_labels = permanent_labels[tail];
+
+            // The tail labels are in lexicographic order, so the first
+            // non-dominated one is the candidate of this arc
+            while(*index < tail_labels.size()) {
+                Point cost = tail_labels[*index]->cost + edge_cost;
+
+                if(!is_dominated(cost, n)) {
+                    if(best_edge == nullptr || lex_le(cost, best_cost)) {
+                        best_cost = std::move(cost);
+                        best_edge = e;
+                        best_pred = tail_labels[*index];
+                    }
+                    break;
+                }
+
+                ++*index;
+            }
+        }
+
+        if(best_edge != nullptr) {
+            push(new Label(std::move(best_cost), n, best_edge, best_pred));
+        }
+    };
+
+    push(new Label(Point(dimension), source, nullptr, nullptr));
+
+    while(!queue.empty()) {
+        Label* label = *queue.begin();
+        queue.erase(queue.begin());
+
+        node n = label->n;
+        queued_label[n] = nullptr;
+
+        // The target may have received new labels after the label
+        // was queued
+        if(n != target && is_dominated(label->cost, target)) {
+            delete label;
+            next_candidate(n);
+            continue;
+        }
+
+        permanent_labels[n].push_back(label);
+        ++number_of_permanent_labels;
+
+        if(n != target) {
+            for(auto adj : n->adjEdges) {
+                edge e = adj->theEdge();
+
+                if(e->isSelfLoop()) {
+                    continue;
+                }
+
+                node v = e->target();
+
+                if(directed) {
+                    if(v == n) {
+                        continue;
+                    }
+                } else {
+                    if(v == n) {
+                        v = e->source();
+                    }
+                }
+
+                Point cost = label->cost + *weights(e);
+
+                if(is_dominated(cost, v)) {
+                    continue;
+                }
+
+                // Replaced labels are generated again from the arc indices
+                Label* queued = queued_label[v];
+                if(queued != nullptr) {
+                    if(!lex_le(cost, queued->cost)) {
+                        continue;
+                    }
+
+                    queue.erase(queued);
+                    delete queued;
+                }
+
+                push(new Label(std::move(cost), v, e, label));
+            }
+        }
+
+        next_candidate(n);
+    }
+
+    list<pair<const list<edge>, const Point>> solutions;
+
+    for(auto label : permanent_labels[target]) {
+        list<edge> path;
+        for(const Label* current = label; current->pred != nullptr; current = current->pred) {
+            path.push_front(current->e);
+        }
+
+        solutions.push_back(make_pair(path, label->cost));
+    }
+
+    add_solutions(solutions.begin(), solutions.end());
+
+    for(auto n : graph.nodes) {
+        for(auto label : permanent_labels[n]) {
+            delete label;
+        }
+    }
+}
+
+}
@@ -0,0 +1,159 @@
+//
+//  ep_two_phase.cpp
+//  mco
+//
+//
+
+#include <mco/ep/two_phase/ep_two_phase.h>
+
+#include <vector>
+#include <list>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+
+using std::vector;
+using std::list;
+using std::pair;
+using std::function;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+using ogdf::edge;
+using ogdf::NodeArray;
+
+#include <mco/basic/point.h>
+#include <mco/basic/lex_point_comparator.h>
+#include <mco/basic/thread_pool.h>
+#include <mco/ep/basic/dijkstra.h>
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/dual_benson/ep_dual_benson.h>
+
+namespace mco {
+
+void EpSolverTwoPhase::
+Solve(Graph& graph,
+      function<const Point*(edge)> weights,
+      node source,
+      node target,
+      bool directed) {
+
+    const unsigned dimension = 2;
+    assert(weights(graph.chooseEdge())->dimension() == dimension);
+
+    reset_solutions();
+    number_of_triangles_ = 0;
+
+    if(directed) {
+        EpSolverMartins solver(epsilon_);
+        solver.set_verbose(false);
+        solver.Solve(graph, weights, dimension, source, target, true);
+
+        add_solutions(solver.solutions().cbegin(), solver.solutions().cend());
+        return;
+    }
+
+    EPDualBensonSolver<> first_phase(epsilon_ > 0 ? epsilon_ : 1E-8);
+    first_phase.Solve(graph, weights, source, target);
+
+    vector<Point> extreme_points;
+    for(auto& solution : first_phase.solutions()) {
+        extreme_points.push_back(solution.second);
+    }
+
+    if(extreme_points.empty()) {
+        return;
+    }
+
+    std::sort(extreme_points.begin(), extreme_points.end(), LexPointComparator());
+
+    // Distances to the target in each objective bound the costs of the
+    // remaining path
+    vector<NodeArray<double>> distances(dimension, graph);
+    for(unsigned i = 0; i < dimension; ++i) {
+        Dijkstra<double> sssp_solver;
+        NodeArray<edge> predecessor(graph);
+
+        auto length = [&weights, i] (edge e) {
+            return weights(e)->operator[](i);
+        };
+
+        sssp_solver.singleSourceShortestPaths(graph,
+                                              length,
+                                              target,
+                                              predecessor,
+                                              distances[i],
+                                              DijkstraModes::Undirected);
+    }
+
+    auto heuristic = [&distances] (node n, unsigned objective) {
+        return distances[objective][n];
+    };
+
+    number_of_triangles_ = std::max(1u, (unsigned) extreme_points.size() - 1);
+
+    vector<list<pair<const list<edge>, const Point>>> partial_frontiers(number_of_triangles_);
+
+    {
+        ThreadPool pool(number_of_threads_);
+
+        for(unsigned j = 0; j < number_of_triangles_; ++j) {
+            pool.submit([&, j] (unsigned) {
+                const Point& p = extreme_points[j];
+                const Point& q = extreme_points[std::min(j + 1, (unsigned) extreme_points.size() - 1)];
+
+                // The heuristic values are summed up in a different order
+                // than the extreme points and must not cut off the corners
+                Point corner({q[0] + 1E-9 * std::max(1.0, std::abs(q[0])),
+                              p[1] + 1E-9 * std::max(1.0, std::abs(p[1]))});
+
+                EpSolverMartins solver(epsilon_);
+                solver.set_verbose(false);
+                solver.Solve(graph,
+                             weights,
+                             dimension,
+                             source,
+                             target,
+                             corner,
+                             heuristic,
+                             list<Point>({p, q}),
+                             false);
+
+                partial_frontiers[j].insert(partial_frontiers[j].end(),
+                                            solver.solutions().cbegin(),
+                                            solver.solutions().cend());
+            });
+        }
+
+        pool.wait();
+    }
+
+    // Neighbouring triangles share their corners, and the relaxed corners
+    // may let in dominated points
+    vector<const pair<const list<edge>, const Point>*> merged;
+    for(auto& frontier : partial_frontiers) {
+        for(auto& solution : frontier) {
+            merged.push_back(&solution);
+        }
+    }
+
+    std::sort(merged.begin(), merged.end(),
+              [] (const pair<const list<edge>, const Point>* s1,
+                  const pair<const list<edge>, const Point>* s2) {
+                  return LexPointComparator()(&s1->second, &s2->second);
+              });
+
+    list<pair<const list<edge>, const Point>> solutions;
+    for(auto solution : merged) {
+        if(solutions.empty() ||
+           solution->second[1] < solutions.back().second[1] - epsilon_) {
+            solutions.push_back(*solution);
+        }
+    }
+
+    add_solutions(solutions.begin(), solutions.end());
+}
+
+}
@@ -12,6 +12,10 @@
 #include <utility>
 #include <set>
 #include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <limits>
+#include <algorithm>
 
 using std::list;
 using std::pair;
@@ -19,8 +23,11 @@ using std::make_pair;
 using std::set;
 using std::make_heap;
 using std::vector;
+using std::stringstream;
+using std::string;
 
 #include <mco/basic/point.h>
+#include <mco/basic/binary_stream.h>
 
 namespace mco {
     
@@ -32,24 +39,24 @@ GraphlessOVE(const Point& initial_value, unsigned dimension, double epsilon)
     
     GraphlessPoint* new_extreme_point;
     for(unsigned int i = 0; i < dimension_ - 1; ++i) {
-        new_extreme_point = new GraphlessPoint(dimension_ + 1);
+        new_extreme_point = vertex_pool_.create(dimension_ + 1);
         
         for(unsigned int j = 0; j < dimension_ - 1; ++j) {
             new_extreme_point->operator[](j) = i == j ? 1 : 0;
             
             if(i != j) {
-                new_extreme_point->active_inequalities_.push_back(j);
+                new_extreme_point->active_inequalities_.set(j);
             }
         }
         
         new_extreme_point->operator[](dimension_ - 1) = initial_value[i];
         new_extreme_point->operator[](dimension_) = 1;
         
-        new_extreme_point->active_inequalities_.push_back(dimension_ - 1);
-        new_extreme_point->active_inequalities_.push_back(dimension_);
+        new_extreme_point->active_inequalities_.set(dimension_ - 1);
+        new_extreme_point->active_inequalities_.set(dimension_);
         new_extreme_point->birth_index_ = dimension_;
 
-        extreme_points_.push_back(new_extreme_point);
+        add_extreme_point(new_extreme_point);
         push_pending(new_extreme_point);
         
         Point new_inequality(dimension_ + 1);
@@ -72,7 +79,7 @@ GraphlessOVE(const Point& initial_value, unsigned dimension, double epsilon)
     
     inequalities_.push_back(std::move(new_inequality));
     
-    new_extreme_point = new GraphlessPoint(dimension_ + 1);
+    new_extreme_point = vertex_pool_.create(dimension_ + 1);
     for(unsigned int j = 0; j < dimension_; ++j) {
         new_extreme_point->operator[](j) = 0;
     }
@@ -81,13 +88,13 @@ GraphlessOVE(const Point& initial_value, unsigned dimension, double epsilon)
     new_extreme_point->operator[](dimension_) = 1;
     
     for(unsigned int i = 0; i < dimension_ - 1; ++i) {
-        new_extreme_point->active_inequalities_.push_back(i);
+        new_extreme_point->active_inequalities_.set(i);
     }
     
-    new_extreme_point->active_inequalities_.push_back(dimension_);
+    new_extreme_point->active_inequalities_.set(dimension_);
     new_extreme_point->birth_index_ = dimension_;
     
-    extreme_points_.push_back(new_extreme_point);
+    add_extreme_point(new_extreme_point);
     push_pending(new_extreme_point);
     
     new_inequality = Point(dimension_ + 1);
@@ -101,7 +108,7 @@ GraphlessOVE(const Point& initial_value, unsigned dimension, double epsilon)
     
     
     // Point at infinity
-    new_extreme_point = new GraphlessPoint(dimension_ + 1);
+    new_extreme_point = vertex_pool_.create(dimension_ + 1);
     for(unsigned int j = 0; j < dimension_ - 1; ++j) {
         new_extreme_point->operator[](j) = 0;
     }
@@ -109,23 +116,172 @@ GraphlessOVE(const Point& initial_value, unsigned dimension, double epsilon)
     new_extreme_point->operator[](dimension_) = 0;
     
     for(unsigned int i = 0; i < dimension_; ++i) {
-        new_extreme_point->active_inequalities_.push_back(i);
+        new_extreme_point->active_inequalities_.set(i);
     }
     
     new_extreme_point->birth_index_ = dimension_ - 1;
     new_extreme_point->set_father(new_extreme_point);
     
-    extreme_points_.push_back(new_extreme_point);
+    add_extreme_point(new_extreme_point);
     permanent_points_.push_back(new_extreme_point);
     
     GraphlessPoint& infinity_point = *permanent_points_.front();
     
+    // The rounded differences of the initial value in the last inequality
+    // may move the vertices away from the initial points
     for(GraphlessPoint* point : pending_points_) {
         point->set_father(&infinity_point);
+        point->error_ = vertex_error(*point);
     }
     
 }
     
+GraphlessOVE::
+GraphlessOVE(std::istream& checkpoint, unsigned dimension, double epsilon)
+:   AbstractOnlineVertexEnumerator(dimension, epsilon) {
+    
+    unsigned number_of_inequalities = BinaryStream::read<unsigned>(checkpoint);
+    for(unsigned i = 0; i < number_of_inequalities; ++i) {
+        inequalities_.push_back(BinaryStream::read_point(checkpoint));
+        
+        if(inequalities_.back().dimension() != dimension_ + 1) {
+            throw std::runtime_error("Checkpoint inequality has the wrong dimension");
+        }
+    }
+    
+    unsigned number_of_points = BinaryStream::read<unsigned>(checkpoint);
+    
+    vector<GraphlessPoint*> points;
+    vector<int> fathers;
+    
+    for(unsigned i = 0; i < number_of_points; ++i) {
+        Point coordinates = BinaryStream::read_point(checkpoint);
+        
+        if(coordinates.dimension() != dimension_ + 1) {
+            throw std::runtime_error("Checkpoint vertex has the wrong dimension");
+        }
+        
+        GraphlessPoint* point = vertex_pool_.create(std::move(coordinates));
+        points.push_back(point);
+        
+        point->birth_index_ = BinaryStream::read<unsigned>(checkpoint);
+        bool pending = BinaryStream::read<unsigned char>(checkpoint) != 0;
+        fathers.push_back(BinaryStream::read<int>(checkpoint));
+        
+        unsigned number_of_active = BinaryStream::read<unsigned>(checkpoint);
+        for(unsigned j = 0; j < number_of_active; ++j) {
+            unsigned inequality = BinaryStream::read<unsigned>(checkpoint);
+            
+            if(inequality >= number_of_inequalities) {
+                throw std::runtime_error("Checkpoint vertex has an unknown active inequality");
+            }
+            
+            point->active_inequalities_.set(inequality);
+        }
+        
+        if((*point)[dimension_] != 0) {
+            point->error_ = vertex_error(*point);
+        }
+        
+        add_extreme_point(point);
+        
+        if(pending) {
+            point->pending = true;
+            pending_points_.push_back(point);
+        }
+    }
+    
+    // Fathers can only be set after all points exist
+    for(unsigned i = 0; i < number_of_points; ++i) {
+        if(fathers[i] < 0) {
+            continue;
+        }
+        
+        if(unsigned(fathers[i]) >= number_of_points) {
+            throw std::runtime_error("Checkpoint vertex has an unknown father");
+        }
+        
+        points[i]->set_father(points[fathers[i]]);
+    }
+    
+    make_heap(pending_points_.begin(),
+              pending_points_.end(),
+              LexPointComparator(epsilon_));
+    
+    for(auto list : {&candidate_points_, &permanent_points_}) {
+        unsigned size = BinaryStream::read<unsigned>(checkpoint);
+        
+        for(unsigned i = 0; i < size; ++i) {
+            unsigned index = BinaryStream::read<unsigned>(checkpoint);
+            
+            if(index >= number_of_points) {
+                throw std::runtime_error("Checkpoint refers to an unknown vertex");
+            }
+            
+            list->push_back(points[index]);
+        }
+    }
+}
+    
+void GraphlessOVE::
+save(std::ostream& checkpoint) const {
+    
+    BinaryStream::write<unsigned>(checkpoint, inequalities_.size());
+    for(auto& inequality : inequalities_) {
+        BinaryStream::write(checkpoint, inequality);
+    }
+    
+    // The live points are numbered in the order of their rows. Removed
+    // points may still be referenced as fathers, but their rows can be
+    // reused by other points.
+    vector<int> indices(extreme_points_.size(), -1);
+    int number_of_points = 0;
+    for(unsigned row = 0; row < extreme_points_.size(); ++row) {
+        if(extreme_points_[row] != nullptr) {
+            indices[row] = number_of_points++;
+        }
+    }
+    
+    auto index = [this, &indices] (const GraphlessPoint* point) {
+        if(point == nullptr || point->removed || extreme_points_[point->row_] != point) {
+            return -1;
+        }
+        
+        return indices[point->row_];
+    };
+    
+    BinaryStream::write<unsigned>(checkpoint, number_of_points);
+    for(auto point : extreme_points_) {
+        if(point == nullptr) {
+            continue;
+        }
+        
+        BinaryStream::write(checkpoint, static_cast<const Point&>(*point));
+        BinaryStream::write<unsigned>(checkpoint, point->birth_index_);
+        BinaryStream::write<unsigned char>(checkpoint, point->pending);
+        BinaryStream::write<int>(checkpoint, index(point->father()));
+        
+        BinaryStream::write<unsigned>(checkpoint, point->active_inequalities_.count());
+        point->active_inequalities_.for_each([&checkpoint] (unsigned inequality) {
+            BinaryStream::write<unsigned>(checkpoint, inequality);
+        });
+    }
+    
+    for(auto list : {&candidate_points_, &permanent_points_}) {
+        vector<unsigned> list_indices;
+        for(auto point : *list) {
+            if(index(point) >= 0) {
+                list_indices.push_back(index(point));
+            }
+        }
+        
+        BinaryStream::write<unsigned>(checkpoint, list_indices.size());
+        for(auto list_index : list_indices) {
+            BinaryStream::write<unsigned>(checkpoint, list_index);
+        }
+    }
+}
+    
 void GraphlessOVE::
 add_hyperplane(Point &vertex, Point &normal, double rhs) {
     
@@ -153,28 +309,14 @@ add_hyperplane(Point &vertex, Point &normal, double rhs) {
     
     // three sets of extreme points:
     // cutted points, on-plane points and inside points
-    list<list<GraphlessPoint*>::iterator> inside_points;
-    list<list<GraphlessPoint*>::iterator> cut_off_points;
+    vector<unsigned> cut_off_rows;
+    vector<unsigned> inside_rows;
+    vector<unsigned> on_plane_rows;
     
-    // Check for each pending point to which set it belongs
-    for(auto it = extreme_points_.begin();
-        it != extreme_points_.end();
-        ++it) {
-        
-        double distance = projective_hyperplane * **it;
-        
-        // point is cut off by the inequality
-        if(distance < -epsilon_) {
-            cut_off_points.push_back(it);
-        
-        // point is inside the inequality induced halfspace
-        } else if(distance > epsilon_) {
-            inside_points.push_back(it);
-            
-        // point is on the inequality induced hyperplane
-        } else {
-            (*it)->active_inequalities_.push_back(inequalities_.size() - 1);
-        }
+    classify(projective_hyperplane, cut_off_rows, inside_rows, on_plane_rows);
+    
+    for(auto row : on_plane_rows) {
+        extreme_points_[row]->active_inequalities_.set(inequalities_.size() - 1);
     }
     
     // list to store new points
@@ -183,21 +325,17 @@ add_hyperplane(Point &vertex, Point &normal, double rhs) {
     // check for each cutted off pending point if there is a permanent
     // or another pending point strictly inside the polytope which makes them a
     // candidate pair
-    for(auto cut_off_it = cut_off_points.begin();
-        cut_off_it != cut_off_points.end();
-        ++cut_off_it) {
+    for(auto cut_off_row : cut_off_rows) {
         
-        GraphlessPoint& cut_off_point = ***cut_off_it;
+        GraphlessPoint& cut_off_point = *extreme_points_[cut_off_row];
         
-        assert(cut_off_point.active_inequalities_.size() >= dimension_);
+        assert(cut_off_point.active_inequalities_.count() >= dimension_);
         
-        for(auto inside_it = inside_points.begin();
-            inside_it != inside_points.end();
-            ++inside_it) {
+        for(auto inside_row : inside_rows) {
             
-            GraphlessPoint& inside_point = ***inside_it;
+            GraphlessPoint& inside_point = *extreme_points_[inside_row];
             
-            assert(inside_point.active_inequalities_.size() >= dimension_);
+            assert(inside_point.active_inequalities_.count() >= dimension_);
             
             if(check_adjacent(cut_off_point, inside_point)) {
                 
@@ -210,21 +348,487 @@ add_hyperplane(Point &vertex, Point &normal, double rhs) {
     }
     
     // mark all cut off points as removed
-    for(auto point_it : cut_off_points) {
-        (*point_it)->removed = true;
-        extreme_points_.erase(point_it);
+    for(auto row : cut_off_rows) {
+        GraphlessPoint* cut_off_point = extreme_points_[row];
+        
+        cut_off_point->removed = true;
+        if(cut_off_point->pending) {
+            ++removed_pending_;
+        }
+        
+        remove_extreme_point(cut_off_point);
     }
     
-    delete last_candidate;
+    vertex_pool_.destroy(last_candidate);
     
     // put all new points in the priority queue and add them to the list
     // of extreme points
     for(auto point : new_points) {
         push_pending(point);
-        extreme_points_.push_back(point);
+        add_extreme_point(point);
+    }
+    
+    if(removed_pending_ > pending_points_.size() / 2) {
+        compact_pending();
+    }
+    
+    if(free_rows_.size() > extreme_points_.size() / 2) {
+        compact_rows();
+    }
+}
+    
+void GraphlessOVE::
+compact_pending() {
+    
+    auto removed_begin = std::partition(pending_points_.begin(),
+                                        pending_points_.end(),
+                                        [] (GraphlessPoint* point) {
+                                            return !point->removed;
+                                        });
+    
+    for(auto it = removed_begin; it != pending_points_.end(); ++it) {
+        vertex_pool_.destroy(*it);
+    }
+    
+    pending_points_.erase(removed_begin, pending_points_.end());
+    removed_pending_ = 0;
+    
+    make_heap(pending_points_.begin(),
+              pending_points_.end(),
+              LexPointComparator(epsilon_));
+}
+    
+void GraphlessOVE::
+compact_rows() {
+    
+    unsigned stride = dimension_ + 1;
+    
+    // Rows only move towards the beginning of the matrix
+    unsigned rows = 0;
+    for(unsigned row = 0; row < extreme_points_.size(); ++row) {
+        GraphlessPoint* point = extreme_points_[row];
+        
+        if(point == nullptr) {
+            continue;
+        }
+        
+        if(row != rows) {
+            std::copy(coordinates_.begin() + row * stride,
+                      coordinates_.begin() + (row + 1) * stride,
+                      coordinates_.begin() + rows * stride);
+            
+            extreme_points_[rows] = point;
+            point->row_ = rows;
+        }
+        
+        ++rows;
+    }
+    
+    extreme_points_.resize(rows);
+    coordinates_.resize(rows * stride);
+    free_rows_.clear();
+}
+    
+double GraphlessOVE::
+coordinate_error() const {
+    
+    double error = 0;
+    for(auto point : extreme_points_) {
+        if(point != nullptr) {
+            error = std::max(error, point->error_);
+        }
+    }
+    
+    return error;
+}
+    
+string GraphlessOVE::
+statistics() const {
+    stringstream statistics;
+    
+    statistics << "Vertices: "
+        << live_vertices() << " live, "
+        << dead_vertices() << " dead"
+        << " (pending: " << pending_points_.size()
+        << ", removed pending: " << removed_pending_
+        << ", pool capacity: " << vertex_pool_.capacity() << ")"
+        << ", exact evaluations: " << exact_evaluations_;
+    
+    return statistics.str();
+}
+    
+namespace {
+    
+// Distances of the rows [begin, end) of the row-major matrix to the
+// hyperplane. Four rows are processed at once, so that the independent
+// sums can be computed in parallel by the processor.
+void hyperplane_distances(const double* coordinates,
+                          unsigned stride,
+                          const double* hyperplane,
+                          double* distances,
+                          size_t begin,
+                          size_t end) {
+    
+    size_t row = begin;
+    for(; row + 4 <= end; row += 4) {
+        const double* row0 = coordinates + row * stride;
+        const double* row1 = row0 + stride;
+        const double* row2 = row1 + stride;
+        const double* row3 = row2 + stride;
+        
+        double distance0 = 0;
+        double distance1 = 0;
+        double distance2 = 0;
+        double distance3 = 0;
+        
+        for(unsigned j = 0; j < stride; ++j) {
+            distance0 += row0[j] * hyperplane[j];
+            distance1 += row1[j] * hyperplane[j];
+            distance2 += row2[j] * hyperplane[j];
+            distance3 += row3[j] * hyperplane[j];
+        }
+        
+        distances[row] = distance0;
+        distances[row + 1] = distance1;
+        distances[row + 2] = distance2;
+        distances[row + 3] = distance3;
+    }
+    
+    for(; row < end; ++row) {
+        const double* row0 = coordinates + row * stride;
+        
+        double distance = 0;
+        for(unsigned j = 0; j < stride; ++j) {
+            distance += row0[j] * hyperplane[j];
+        }
+        
+        distances[row] = distance;
+    }
+}
+    
+// Number of rows from which the classification is split among the threads
+const size_t parallel_rows = 1 << 14;
+    
+double max_norm(const Point& point) {
+    double norm = 0;
+    for(auto coordinate = point.cbegin(); coordinate != point.cend(); ++coordinate) {
+        norm = std::max(norm, std::abs(*coordinate));
+    }
+    
+    return norm;
+}
+    
+}
+    
+void GraphlessOVE::
+classify(const Point& hyperplane,
+         vector<unsigned>& cut_off_rows,
+         vector<unsigned>& inside_rows,
+         vector<unsigned>& on_plane_rows) {
+    
+    unsigned stride = dimension_ + 1;
+    size_t rows = extreme_points_.size();
+    
+    distances_.resize(rows);
+    
+    if(rows < parallel_rows || number_of_threads_ == 1) {
+        hyperplane_distances(coordinates_.data(),
+                             stride,
+                             hyperplane.cbegin(),
+                             distances_.data(),
+                             0,
+                             rows);
+        
+    } else {
+        if(!pool_) {
+            pool_.reset(new ThreadPool(number_of_threads_));
+        }
+        
+        size_t chunk = (rows + number_of_threads_ - 1) / number_of_threads_;
+        
+        for(size_t begin = 0; begin < rows; begin += chunk) {
+            size_t end = std::min(rows, begin + chunk);
+            
+            pool_->submit([this, stride, &hyperplane, begin, end] (unsigned) {
+                hyperplane_distances(coordinates_.data(),
+                                     stride,
+                                     hyperplane.cbegin(),
+                                     distances_.data(),
+                                     begin,
+                                     end);
+            });
+        }
+        
+        pool_->wait();
+    }
+    
+    double hyperplane_norm = max_norm(hyperplane);
+    
+    for(unsigned row = 0; row < rows; ++row) {
+        if(extreme_points_[row] == nullptr) {
+            continue;
+        }
+        
+        int point_side = side(*extreme_points_[row],
+                              hyperplane,
+                              hyperplane_norm,
+                              distances_[row]);
+        
+        // point is cut off by the inequality
+        if(point_side < 0) {
+            cut_off_rows.push_back(row);
+            
+        // point is inside the inequality induced halfspace
+        } else if(point_side > 0) {
+            inside_rows.push_back(row);
+            
+        // point is on the inequality induced hyperplane
+        } else {
+            on_plane_rows.push_back(row);
+        }
+    }
+}
+    
+    
+vector<vector<double>> GraphlessOVE::
+independent_active_rows(const GraphlessPoint& point) const {
+    
+    vector<vector<double>> rows;
+    vector<vector<double>> reduced_rows;
+    vector<unsigned> pivots;
+    
+    point.active_inequalities_.for_each([&] (unsigned inequality_index) {
+        if(rows.size() == dimension_) {
+            return;
+        }
+        
+        const Point& inequality = inequalities_[inequality_index];
+        vector<double> row(inequality.cbegin(), inequality.cend());
+        vector<double> reduced_row = row;
+        
+        for(unsigned i = 0; i < reduced_rows.size(); ++i) {
+            double factor = reduced_row[pivots[i]] / reduced_rows[i][pivots[i]];
+            for(unsigned j = 0; j < dimension_ + 1; ++j) {
+                reduced_row[j] -= factor * reduced_rows[i][j];
+            }
+        }
+        
+        unsigned pivot = 0;
+        for(unsigned j = 0; j < dimension_ + 1; ++j) {
+            if(std::abs(reduced_row[j]) > std::abs(reduced_row[pivot])) {
+                pivot = j;
+            }
+        }
+        
+        if(std::abs(reduced_row[pivot]) > 1E-12 * max_norm(inequality)) {
+            rows.push_back(std::move(row));
+            reduced_rows.push_back(std::move(reduced_row));
+            pivots.push_back(pivot);
+        }
+    });
+    
+    return rows;
+}
+    
+double GraphlessOVE::
+vertex_error(const GraphlessPoint& point) const {
+    
+    vector<vector<double>> rows = independent_active_rows(point);
+    
+    if(rows.size() < dimension_) {
+        return std::numeric_limits<double>::infinity();
+    }
+    
+    const double u = RobustPredicates::epsilon;
+    auto gamma = [u] (unsigned k) {
+        return k * u / (1 - k * u);
+    };
+    
+    // The vertex solves B x = -c, where B are the first dimension_ columns
+    // of the rows and c is their last column, so the point differs from
+    // it by B^-1 r for the residuals r of the rows
+    double residual = 0;
+    for(auto& row : rows) {
+        double magnitude = 0;
+        for(unsigned j = 0; j < dimension_ + 1; ++j) {
+            magnitude += std::abs(row[j] * point[j]);
+        }
+        
+        double row_residual = RobustPredicates::dot(row.data(), point.cbegin(), dimension_ + 1);
+        residual = std::max(residual,
+                            (1 + u) * std::abs(row_residual)
+                            + gamma(2 * dimension_ + 2) * gamma(2 * dimension_ + 2) * magnitude);
+    }
+    
+    // Approximate inverse R of B by Gauss-Jordan elimination
+    vector<vector<double>> matrix(dimension_, vector<double>(2 * dimension_, 0));
+    for(unsigned i = 0; i < dimension_; ++i) {
+        std::copy(rows[i].begin(), rows[i].begin() + dimension_, matrix[i].begin());
+        matrix[i][dimension_ + i] = 1;
+    }
+    
+    for(unsigned i = 0; i < dimension_; ++i) {
+        unsigned pivot = i;
+        for(unsigned k = i + 1; k < dimension_; ++k) {
+            if(std::abs(matrix[k][i]) > std::abs(matrix[pivot][i])) {
+                pivot = k;
+            }
+        }
+        
+        if(matrix[pivot][i] == 0) {
+            return std::numeric_limits<double>::infinity();
+        }
+        
+        std::swap(matrix[i], matrix[pivot]);
+        
+        for(unsigned k = 0; k < dimension_; ++k) {
+            if(k == i) {
+                continue;
+            }
+            
+            double factor = matrix[k][i] / matrix[i][i];
+            for(unsigned j = i; j < 2 * dimension_; ++j) {
+                matrix[k][j] -= factor * matrix[i][j];
+            }
+        }
+    }
+    
+    // ||B^-1|| <= ||R|| / (1 - ||I - R B||) if ||I - R B|| < 1, where the
+    // norms are maximum row sums and the rounding errors of R B are bounded
+    double inverse_norm = 0;
+    double defect = 0;
+    
+    for(unsigned i = 0; i < dimension_; ++i) {
+        double row_norm = 0;
+        double row_defect = 0;
+        
+        for(unsigned j = 0; j < dimension_; ++j) {
+            double inverse_entry = matrix[i][dimension_ + j] / matrix[i][i];
+            matrix[i][dimension_ + j] = inverse_entry;
+            row_norm += std::abs(inverse_entry);
+        }
+        
+        for(unsigned j = 0; j < dimension_; ++j) {
+            double product = 0;
+            double magnitude = 0;
+            for(unsigned k = 0; k < dimension_; ++k) {
+                product += matrix[i][dimension_ + k] * rows[k][j];
+                magnitude += std::abs(matrix[i][dimension_ + k] * rows[k][j]);
+            }
+            
+            row_defect += (1 + u) * std::abs((i == j ? 1 : 0) - product)
+                + gamma(dimension_ + 1) * magnitude;
+        }
+        
+        inverse_norm = std::max(inverse_norm, (1 + gamma(dimension_)) * row_norm);
+        defect = std::max(defect, (1 + gamma(dimension_)) * row_defect);
+    }
+    
+    if(defect >= 1) {
+        return std::numeric_limits<double>::infinity();
     }
+    
+    return (1 + gamma(4)) * inverse_norm * residual / (1 - defect);
 }
     
+int GraphlessOVE::
+exact_side(const GraphlessPoint& point,
+           const Point& hyperplane,
+           double distance) {
+    
+    int rounded_side = distance < -epsilon_ ? -1 : (distance > epsilon_ ? 1 : 0);
+    
+    // The selection is only a floating point guess, which is verified by
+    // the determinants below
+    vector<vector<double>> rows = independent_active_rows(point);
+    
+    if(rows.size() < dimension_) {
+        return rounded_side;
+    }
+    
+    // The point is proportional to x with x_j = (-1)^j M_j, where M_j is
+    // the determinant of the rows without column j, and
+    // hyperplane * x = (-1)^dimension_ D with D = det(rows, hyperplane).
+    // Scaled to the rounded point by its coordinate k, the distance is
+    // (-1)^(dimension_ + k) point_k D / M_k.
+    unsigned k = dimension_;
+    if(point[dimension_] == 0) {
+        for(unsigned j = 0; j < dimension_; ++j) {
+            if(std::abs(point[j]) > std::abs(point[k])) {
+                k = j;
+            }
+        }
+    }
+    
+    vector<vector<double>> minor_rows;
+    for(auto& row : rows) {
+        vector<double> minor_row;
+        for(unsigned j = 0; j < dimension_ + 1; ++j) {
+            if(j != k) {
+                minor_row.push_back(row[j]);
+            }
+        }
+        minor_rows.push_back(std::move(minor_row));
+    }
+    
+    rows.push_back(vector<double>(hyperplane.cbegin(), hyperplane.cend()));
+    
+    double factor = (k + dimension_) % 2 == 0 ? point[k] : -point[k];
+    
+    double minor_error;
+    double minor = RobustPredicates::determinant(minor_rows, minor_error);
+    
+    double determinant_error;
+    double determinant = RobustPredicates::determinant(rows, determinant_error);
+    
+    // Interval of the distance from the floating point determinants
+    if(std::abs(minor) > 2 * minor_error) {
+        double quotient = determinant / minor;
+        double quotient_error = (determinant_error + std::abs(quotient) * minor_error)
+            / (std::abs(minor) - minor_error);
+        
+        double exact_distance = factor * quotient;
+        double error_bound = std::abs(factor) * quotient_error
+            + 4 * RobustPredicates::epsilon * std::abs(exact_distance);
+        
+        if(exact_distance + error_bound < -epsilon_) {
+            return -1;
+        } else if(exact_distance - error_bound > epsilon_) {
+            return 1;
+        } else if(std::abs(exact_distance) + error_bound < epsilon_) {
+            return 0;
+        }
+    }
+    
+    ++exact_evaluations_;
+    
+    Expansion exact_minor = RobustPredicates::exact_determinant(minor_rows);
+    int minor_sign = exact_minor.sign();
+    
+    if(minor_sign == 0) {
+        return rounded_side;
+    }
+    
+    // distance |M_k| = (-1)^(dimension_ + k) point_k sign(M_k) D is compared
+    // with -epsilon |M_k| and epsilon |M_k|
+    Expansion scaled_distance
+        = RobustPredicates::exact_determinant(rows).scaled(factor * minor_sign);
+    Expansion scaled_epsilon = exact_minor.scaled(epsilon_ * minor_sign);
+    
+    Expansion lower = scaled_distance;
+    lower.add(scaled_epsilon);
+    if(lower.sign() < 0) {
+        return -1;
+    }
+    
+    Expansion upper = scaled_distance;
+    upper.add(scaled_epsilon.scaled(-1));
+    if(upper.sign() > 0) {
+        return 1;
+    }
+    
+    return 0;
+}
     
 bool GraphlessOVE::
 check_adjacent(GraphlessPoint& p1, const GraphlessPoint& p2) {
@@ -292,122 +896,111 @@ check_adjacent(GraphlessPoint& p1, const GraphlessPoint& p2) {
     }
 #endif
     
+    // Adjacent points have at least dimension - 1 common active
+    // inequalities, which rejects most pairs without any geometry
+    unsigned tight_count = p1.active_inequalities_.intersection_count(p2.active_inequalities_);
+    
     if(dimension_ <= 3) {
         
-		list<int> inequality_intersection;
-                
-		set_intersection(p1.active_inequalities_.cbegin(),
-                         p1.active_inequalities_.cend(),
-                         p2.active_inequalities_.cbegin(),
-                         p2.active_inequalities_.cend(),
-                         back_inserter(inequality_intersection));
-        
-		unsigned tight_inequalities = inequality_intersection.size();
+		if(tight_count < dimension_ - 1)
+			return false;
         
-		if(tight_inequalities == dimension_ - 1)
+        // Exactly dimension - 1 common active inequalities define the line
+        // of an edge. More occur for degenerate polyhedra, where the common
+        // inequalities may also define a larger face, so that the common
+        // points are counted below.
+		if(tight_count == dimension_ - 1)
 			return true;
-		else if(tight_inequalities < dimension_ - 1)
-			return false;
-		else
-			assert(false);
         
 	} else {
-		list<unsigned int> tight_inequalities;
-        
-		set_intersection(p1.active_inequalities_.cbegin(),
-                         p1.active_inequalities_.cend(),
-                         p2.active_inequalities_.cbegin(),
-                         p2.active_inequalities_.cend(),
-                         back_inserter(tight_inequalities));
-        
-		unsigned int k = max(p1.birth_index_, p2.birth_index_);
-		bool nc2 = false;
-        
-		for(auto index: tight_inequalities) {
-			if(index >= k && index <= inequalities_.size() - 1) {
-				nc2 = true;
-				break;
-			}
-        }
         
-		// [FP96] NC2
-		if(!nc2) {
+		// [FP96] NC1
+		if(tight_count < dimension_ - 2) {
 #ifndef NDEBUG
             if(debug_output) {
-                cout << "Not adjacent, because auf NC2" << endl;
+                cout << "Not adjacent, because of NC1" << endl;
             }
 #endif
 			return false;
         }
         
-		// [FP96] NC1
-		if(tight_inequalities.size() < dimension_ - 2) {
+		unsigned int k = max(p1.birth_index_, p2.birth_index_);
+        
+		// [FP96] NC2
+		if(!p1.active_inequalities_.intersects_from(p2.active_inequalities_, k)) {
 #ifndef NDEBUG
             if(debug_output) {
-                cout << "Not adjacent, because of NC1" << endl;
+                cout << "Not adjacent, because auf NC2" << endl;
             }
 #endif
 			return false;
         }
+    }
+    
+    DynamicBitset tight_inequalities
+        = DynamicBitset::intersection(p1.active_inequalities_,
+                                      p2.active_inequalities_);
+    
+    assert(candidate_points_.empty());
+    
+    for(unsigned i = inequality_norms_.size(); i < inequalities_.size(); ++i) {
+        inequality_norms_.push_back(max_norm(inequalities_[i]));
+    }
+    
+    unsigned common_count = 0;
+    
+	for(auto test_point : extreme_points_) {
         
-        vector<bool> common_vertices(extreme_points_.size(), true);
-        
-        assert(candidate_points_.empty());
+        if(test_point == nullptr) {
+            continue;
+        }
         
-		for(auto inequality_index : tight_inequalities) {
-            
-			Point& inequality = inequalities_[inequality_index];
+        // Points active on all tight inequalities are common without
+        // evaluating the inequalities
+        if(tight_inequalities.is_subset_of(test_point->active_inequalities_)) {
+            ++common_count;
             
-			list<GraphlessPoint *> new_vertices;
+        } else {
+            bool common = true;
             
-            unsigned i = 0;
-			for(auto test_point : extreme_points_) {
-                
-#ifndef NDEBUG
-                if(debug_output) {
-                    cout << "checking point " << *test_point << ": " <<
-                    inequality * *test_point;
+            tight_inequalities.for_each([&] (unsigned inequality_index) {
+                if(common &&
+                   !test_point->active_inequalities_.test(inequality_index) &&
+                   side(*test_point,
+                        inequalities_[inequality_index],
+                        inequality_norms_[inequality_index],
+                        inequalities_[inequality_index] * *test_point) != 0) {
+                    
+                    common = false;
                 }
-#endif
-                
-				if(std::abs(inequality * *test_point) > epsilon_) {
-					common_vertices[i] = false;
-#ifndef NDEBUG
-                    if(debug_output) {
-                        cout << " X" << endl;
-                    }
-#endif
-                }
-                
-#ifndef NDEBUG
-                else {
-                    if(debug_output) {
-                        cout << endl;
-                    }
-                }
-#endif
-                ++i;
-			}
-
-		}
-
-        unsigned common_count = std::count(common_vertices.cbegin(),
-                                           common_vertices.cend(),
-                                           true);        
+            });
+            
+            if(common) {
+                ++common_count;
+            }
+        }
+        
 #ifndef NDEBUG
         if(debug_output) {
-            cout << "Number of common points: " << common_count << endl;
+            cout << "checking point " << *test_point << endl;
         }
 #endif
         
-		if(common_count == 2)
-			return true;
-		else
-			return false;
-        
+        if(common_count > 2) {
+            break;
+        }
 	}
     
-	return true;
+#ifndef NDEBUG
+    if(debug_output) {
+        cout << "Number of common points: " << common_count << endl;
+    }
+#endif
+    
+	if(common_count == 2)
+		return true;
+	else
+		return false;
 }
     
 auto GraphlessOVE::
@@ -423,26 +1016,40 @@ add_cut_point(const GraphlessPoint& outside_point,
         " and inside point " << inside_point << " : ";
 #endif
     
-    double alpha = - inequality * outside_point;
-    Point diff_direction = inside_point - outside_point;
-    
-    assert(std::abs(inequality * diff_direction) > epsilon_);
+    // The distances are computed separately, so that the difference of the
+    // points does not cancel digits of the denominator
+    double outside_distance = RobustPredicates::dot(inequality.cbegin(),
+                                                    outside_point.cbegin(),
+                                                    dimension_ + 1);
+    double inside_distance = RobustPredicates::dot(inequality.cbegin(),
+                                                   inside_point.cbegin(),
+                                                   dimension_ + 1);
     
-    alpha /=  inequality * diff_direction;
+    // Sides decided by exact_side may disagree with the signs of tiny
+    // rounded distances, which are on the hyperplane up to rounding
+    double outside_depth = std::max(-outside_distance, 0.0);
+    double inside_depth = std::max(inside_distance, 0.0);
     
-    assert(alpha > epsilon_ && alpha < 1 + epsilon_);
+    double alpha;
+    if(outside_depth == 0) {
+        alpha = 0;
+    } else if(inside_depth == 0) {
+        alpha = 1;
+    } else {
+        alpha = outside_depth / (outside_depth + inside_depth);
+    }
     
+    Point diff_direction = inside_point - outside_point;
     diff_direction *= alpha;
-    GraphlessPoint* cut_point = new GraphlessPoint(outside_point + diff_direction);
+    GraphlessPoint* cut_point = vertex_pool_.create(outside_point + diff_direction);
     ProjectiveGeometry::normalize_projective(*cut_point);
     
-    set_intersection(outside_point.active_inequalities_.cbegin(),
-                     outside_point.active_inequalities_.cend(),
-                     inside_point.active_inequalities_.cbegin(),
-                     inside_point.active_inequalities_.cend(),
-                     back_inserter(cut_point->active_inequalities_));
+    cut_point->active_inequalities_
+        = DynamicBitset::intersection(outside_point.active_inequalities_,
+                                      inside_point.active_inequalities_);
     
-    cut_point->active_inequalities_.push_back(inequalities_.size() - 1);
+    cut_point->active_inequalities_.set(inequalities_.size() - 1);
+    cut_point->error_ = vertex_error(*cut_point);
         
     cut_point->set_father(&inside_point);
     cut_point->birth_index_ = inequalities_.size() - 1;
@@ -454,9 +1061,9 @@ add_cut_point(const GraphlessPoint& outside_point,
 #endif
 
 #ifndef NDEBUG
-    if(cut_point->active_inequalities_.size() < dimension_) {
+    if(cut_point->active_inequalities_.count() < dimension_) {
         cout << "New point " << *cut_point << " has only " <<
-        cut_point->active_inequalities_.size() << " active inequalities" << endl;
+        cut_point->active_inequalities_.count() << " active inequalities" << endl;
         assert(false);
     }
 #endif
@@ -0,0 +1,401 @@
+//
+//  ove_planar_subdivision.cpp
+//  mco
+//
+//
+
+#include <mco/generic/benson_dual/ove_planar_subdivision.h>
+
+#include <vector>
+
+using std::vector;
+
+namespace mco {
+
+PlanarSubdivisionOVE::
+PlanarSubdivisionOVE(const Point& initial_value,
+                     unsigned dimension,
+                     double epsilon)
+:   AbstractOnlineVertexEnumerator(dimension, epsilon),
+    number_of_hyperplanes_(dimension + 1) {
+
+    assert(dimension_ == 3);
+
+    // The weight triangle, where the initial value supports the upper
+    // boundary everywhere
+    Vertex* origin = create_vertex(Point({0, 0, initial_value[2]}), true);
+    Vertex* first = create_vertex(Point({1, 0, initial_value[0]}), true);
+    Vertex* second = create_vertex(Point({0, 1, initial_value[1]}), true);
+
+    outer_face_ = face_pool_.create();
+    outer_face_->outer = true;
+
+    Face* face = face_pool_.create();
+    ++number_of_faces_;
+
+    // Counterclockwise inside, clockwise outside
+    vector<HalfEdge*> edges = {
+        create_edge(origin, first, face, outer_face_),
+        create_edge(first, second, face, outer_face_),
+        create_edge(second, origin, face, outer_face_)
+    };
+
+    for(unsigned i = 0; i < 3; ++i) {
+        HalfEdge* edge = edges[i];
+        HalfEdge* next_edge = edges[(i + 1) % 3];
+
+        edge->next = next_edge;
+        next_edge->prev = edge;
+
+        next_edge->twin->next = edge->twin;
+        edge->twin->prev = next_edge->twin;
+
+        edge->origin->edge = edge;
+    }
+
+    face->edge = edges[0];
+    outer_face_->edge = edges[0]->twin;
+
+    for(auto vertex : {origin, first, second}) {
+        push_pending(vertex);
+    }
+}
+
+void PlanarSubdivisionOVE::
+add_hyperplane(Point &vertex, Point &normal, double rhs) {
+
+    ++number_of_hyperplanes_;
+    ++stamp_;
+    normal_ = &normal;
+    rhs_ = rhs;
+
+    // In the dual Benson algorithm, the last candidate is always cut off
+    Vertex* start = last_candidate_;
+    last_candidate_ = nullptr;
+
+    if(start == nullptr || distance(start) >= -epsilon_) {
+        start = nullptr;
+        for(auto v : vertices_) {
+            if(distance(v) < -epsilon_) {
+                start = v;
+                break;
+            }
+        }
+    }
+
+    if(start == nullptr) {
+        return;
+    }
+
+    // The cut off vertices are connected by the edges of the subdivision
+    vector<Vertex*> cut_vertices = { start };
+    vector<HalfEdge*> cut_edges;
+    vector<Face*> faces;
+
+    start->cut_stamp = stamp_;
+
+    for(unsigned i = 0; i < cut_vertices.size(); ++i) {
+        HalfEdge* edge = cut_vertices[i]->edge;
+
+        do {
+            cut_edges.push_back(edge);
+
+            if(edge->face->stamp != stamp_) {
+                edge->face->stamp = stamp_;
+                faces.push_back(edge->face);
+            }
+
+            Vertex* neighbor = edge->twin->origin;
+            if(!is_cut(neighbor) && distance(neighbor) < -epsilon_) {
+                neighbor->cut_stamp = stamp_;
+                cut_vertices.push_back(neighbor);
+            }
+
+            edge = edge->twin->next;
+        } while(edge != cut_vertices[i]->edge);
+    }
+
+    // A face is removed if none of its vertices stays strictly inside
+    for(auto face : faces) {
+        face->removed = !face->outer;
+
+        HalfEdge* edge = face->edge;
+        do {
+            if(!is_cut(edge->origin) && distance(edge->origin) > epsilon_) {
+                face->removed = false;
+                break;
+            }
+
+            edge = edge->next;
+        } while(edge != face->edge);
+    }
+
+    vector<Chain> chains;
+    vector<HalfEdge*> new_face_edges;
+    vector<HalfEdge*> dead_edges;
+
+    for(auto face : faces) {
+        HalfEdge* edge = face->edge;
+
+        do {
+            Vertex* origin = edge->origin;
+            Vertex* destination = edge->twin->origin;
+
+            if(face->removed) {
+                // Edges on the hyperplane bound the new face, unless they
+                // are between two removed faces
+                if(!is_cut(origin) && !is_cut(destination)) {
+                    Face* twin_face = edge->twin->face;
+
+                    if(twin_face->stamp == stamp_ && twin_face->removed) {
+                        dead_edges.push_back(edge);
+                    } else {
+                        new_face_edges.push_back(edge);
+                    }
+                }
+
+            } else if(!is_cut(origin) && is_cut(destination)) {
+                Chain chain;
+                chain.face = face;
+                chain.in = edge;
+                chain.out = edge->next;
+
+                while(true) {
+                    if(face->outer && chain.out->origin->corner) {
+                        chain.corners.push_back(chain.out->origin);
+                    }
+
+                    if(!is_cut(chain.out->twin->origin)) {
+                        break;
+                    }
+
+                    chain.out = chain.out->next;
+                }
+
+                chains.push_back(std::move(chain));
+            }
+
+            edge = edge->next;
+        } while(edge != face->edge);
+    }
+
+    Face* new_face = face_pool_.create();
+    ++number_of_faces_;
+
+    // Replace every chain by the part of the boundary of the cut off region
+    // inside the face
+    for(auto& chain : chains) {
+        Vertex* in_vertex = chain.in->origin;
+        Vertex* out_vertex = chain.out->twin->origin;
+
+        HalfEdge* before = chain.in;
+        Vertex* first = in_vertex;
+        if(distance(in_vertex) > epsilon_) {
+            first = split(chain.in);
+        } else {
+            before = chain.in->prev;
+        }
+
+        HalfEdge* after = chain.out;
+        Vertex* last = out_vertex;
+        if(distance(out_vertex) > epsilon_) {
+            last = split(chain.out->twin);
+        } else {
+            after = chain.out->next;
+        }
+
+        // Outside of the triangle, the region is bounded by the hyperplane
+        // above the cut off corners
+        vector<Vertex*> path = { first };
+        for(auto corner : chain.corners) {
+            double w1 = corner->point[0];
+            double w2 = corner->point[1];
+            double y = (rhs_ - normal[0] * w1 - normal[1] * w2) / normal[2];
+
+            Vertex* new_corner = create_vertex(Point({w1, w2, y}), true);
+            push_pending(new_corner);
+            path.push_back(new_corner);
+        }
+        path.push_back(last);
+
+        // The chain is the whole boundary of the face but one vertex on
+        // the hyperplane, so that the path is the new boundary
+        if(chain.out->next == chain.in && first == in_vertex && last == out_vertex) {
+            before = nullptr;
+            after = nullptr;
+        }
+
+        HalfEdge* previous = before;
+        HalfEdge* first_edge = nullptr;
+        for(unsigned i = 0; i + 1 < path.size(); ++i) {
+            HalfEdge* edge = create_edge(path[i], path[i + 1], chain.face, new_face);
+
+            if(previous != nullptr) {
+                previous->next = edge;
+                edge->prev = previous;
+            } else {
+                first_edge = edge;
+            }
+            previous = edge;
+
+            new_face_edges.push_back(edge->twin);
+        }
+
+        if(after == nullptr) {
+            after = first_edge;
+        }
+
+        previous->next = after;
+        after->prev = previous;
+
+        chain.face->edge = after;
+        last->edge = after;
+    }
+
+    assert(new_face_edges.size() >= 3);
+
+    for(auto edge : new_face_edges) {
+        edge->face = new_face;
+        edge->origin->new_face_edge = edge;
+        edge->origin->edge = edge;
+    }
+
+    for(auto edge : new_face_edges) {
+        HalfEdge* next_edge = edge->twin->origin->new_face_edge;
+
+        edge->next = next_edge;
+        next_edge->prev = edge;
+    }
+
+    new_face->edge = new_face_edges.front();
+
+    // Edges at cut off vertices which were not shortened by a split
+    for(auto edge : cut_edges) {
+        if(is_cut(edge->origin)) {
+            dead_edges.push_back(edge);
+        }
+    }
+
+    // Both half-edges of an edge may be in dead_edges
+    vector<HalfEdge*> unique_dead_edges;
+    for(auto edge : dead_edges) {
+        if(!edge->dead) {
+            edge->dead = true;
+            edge->twin->dead = true;
+            unique_dead_edges.push_back(edge);
+        }
+    }
+
+    for(auto edge : unique_dead_edges) {
+        edge_pool_.destroy(edge->twin);
+        edge_pool_.destroy(edge);
+    }
+
+    for(auto face : faces) {
+        if(face->removed) {
+            face_pool_.destroy(face);
+            --number_of_faces_;
+        }
+    }
+
+    for(auto cut_vertex : cut_vertices) {
+        remove_vertex(cut_vertex);
+    }
+
+    if(removed_pending_ > pending_vertices_.size() / 2) {
+        compact_pending();
+    }
+}
+
+auto PlanarSubdivisionOVE::
+create_vertex(Point&& point, bool corner) -> Vertex* {
+    Vertex* vertex = vertex_pool_.create(std::move(point));
+
+    vertex->corner = corner;
+    vertex->index = vertices_.size();
+    vertices_.push_back(vertex);
+
+    return vertex;
+}
+
+void PlanarSubdivisionOVE::
+remove_vertex(Vertex* vertex) {
+    vertices_[vertex->index] = vertices_.back();
+    vertices_[vertex->index]->index = vertex->index;
+    vertices_.pop_back();
+
+    vertex->removed = true;
+
+    if(vertex->pending) {
+        ++removed_pending_;
+    } else {
+        vertex_pool_.destroy(vertex);
+    }
+}
+
+auto PlanarSubdivisionOVE::
+create_edge(Vertex* origin,
+            Vertex* destination,
+            Face* face,
+            Face* twin_face) -> HalfEdge* {
+
+    HalfEdge* edge = edge_pool_.create();
+    HalfEdge* twin = edge_pool_.create();
+
+    edge->origin = origin;
+    edge->twin = twin;
+    edge->face = face;
+
+    twin->origin = destination;
+    twin->twin = edge;
+    twin->face = twin_face;
+
+    return edge;
+}
+
+auto PlanarSubdivisionOVE::
+split(HalfEdge* edge) -> Vertex* {
+    // The origin of edge is inside, its destination is cut off
+    if(edge->split_stamp == stamp_) {
+        return edge->split;
+    }
+
+    Vertex* inside = edge->origin;
+    Vertex* outside = edge->twin->origin;
+
+    double inside_distance = distance(inside);
+    double alpha = inside_distance / (inside_distance - distance(outside));
+
+    Point point = inside->point + alpha * (outside->point - inside->point);
+
+    Vertex* vertex = create_vertex(std::move(point), false);
+    push_pending(vertex);
+
+    edge->twin->origin = vertex;
+    edge->split_stamp = stamp_;
+    edge->split = vertex;
+
+    return vertex;
+}
+
+void PlanarSubdivisionOVE::
+compact_pending() {
+    auto removed_begin = std::partition(pending_vertices_.begin(),
+                                        pending_vertices_.end(),
+                                        [] (Vertex* vertex) {
+                                            return !vertex->removed;
+                                        });
+
+    for(auto it = removed_begin; it != pending_vertices_.end(); ++it) {
+        vertex_pool_.destroy(*it);
+    }
+
+    pending_vertices_.erase(removed_begin, pending_vertices_.end());
+    removed_pending_ = 0;
+
+    std::make_heap(pending_vertices_.begin(),
+                   pending_vertices_.end(),
+                   VertexComparator(epsilon_));
+}
+
+}
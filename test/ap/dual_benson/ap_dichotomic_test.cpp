@@ -0,0 +1,101 @@
+//
+//  ap_dichotomic_test.cpp
+//  mco
+//
+//
+
+#include <set>
+#include <list>
+#include <vector>
+#include <random>
+
+using std::set;
+using std::list;
+using std::vector;
+
+#include <gtest/gtest.h>
+
+using ::testing::Range;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+using ogdf::edge;
+using ogdf::EdgeArray;
+
+#include <mco/basic/point.h>
+#include <mco/ap/basic/ap_instance.h>
+#include <mco/ap/benson_dual/ap_benson_dual_solver.h>
+#include <mco/generic/benson_dual/ove_fp_v2.h>
+
+using mco::Point;
+using mco::AssignmentInstance;
+using mco::APBensonDualSolver;
+using mco::APDichotomicSolver;
+using mco::GraphlessOVE;
+
+namespace {
+
+template<class Solver>
+set<vector<double>> extreme_points(const Solver& solver) {
+    set<vector<double>> points;
+    for(auto& solution : solver.solutions()) {
+        points.insert(vector<double>(solution.second.cbegin(), solution.second.cend()));
+    }
+    return points;
+}
+
+}
+
+/**
+ * Random bi-objective assignment instances on complete bipartite graphs.
+ * The costs are small integers, such that there are many ties.
+ */
+class APDichotomicTestFixture
+: public ::testing::TestWithParam<unsigned> { };
+
+TEST_P(APDichotomicTestFixture, SameExtremePointsAsDualBenson) {
+    std::mt19937 generator(GetParam());
+    std::uniform_int_distribution<int> cost_distribution(0, 20);
+    
+    Graph graph;
+    EdgeArray<Point*> costs(graph);
+    set<node> agents;
+    
+    const unsigned number_of_agents = 8;
+    
+    list<node> jobs;
+    for(unsigned i = 0; i < number_of_agents; ++i) {
+        agents.insert(graph.newNode());
+        jobs.push_back(graph.newNode());
+    }
+    
+    for(auto agent : agents) {
+        for(auto job : jobs) {
+            edge e = graph.newEdge(agent, job);
+            
+            costs[e] = new Point(2);
+            (*costs[e])[0] = cost_distribution(generator);
+            (*costs[e])[1] = cost_distribution(generator);
+        }
+    }
+    
+    AssignmentInstance instance(graph, costs, agents, 2);
+    
+    APBensonDualSolver<GraphlessOVE> benson;
+    benson.Solve(instance);
+    
+    APDichotomicSolver dichotomic(1E-8, 4);
+    dichotomic.Solve(instance);
+    
+    EXPECT_EQ(extreme_points(benson), extreme_points(dichotomic));
+    
+    for(auto e : graph.edges) {
+        delete costs[e];
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(RandomInstances,
+                        APDichotomicTestFixture,
+                        Range(1u, 11u));
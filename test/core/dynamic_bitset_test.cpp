@@ -0,0 +1,72 @@
+//
+//  dynamic_bitset_test.cpp
+//  mco
+//
+//
+
+#include <vector>
+
+using std::vector;
+
+#include <gtest/gtest.h>
+
+#include <mco/basic/dynamic_bitset.h>
+
+using mco::DynamicBitset;
+
+TEST(DynamicBitsetTest, SetAndTest) {
+    DynamicBitset bitset;
+
+    bitset.set(3);
+    bitset.set(64);
+    bitset.set(200);
+
+    EXPECT_TRUE(bitset.test(3));
+    EXPECT_TRUE(bitset.test(64));
+    EXPECT_TRUE(bitset.test(200));
+    EXPECT_FALSE(bitset.test(4));
+    EXPECT_FALSE(bitset.test(1000));
+    EXPECT_EQ(3u, bitset.count());
+
+    bitset.reset(64);
+    bitset.reset(1000);
+
+    EXPECT_FALSE(bitset.test(64));
+    EXPECT_EQ(2u, bitset.count());
+}
+
+TEST(DynamicBitsetTest, Intersections) {
+    DynamicBitset bitset1;
+    DynamicBitset bitset2;
+
+    for(unsigned i : {0, 5, 63, 64, 130, 300}) {
+        bitset1.set(i);
+    }
+
+    for(unsigned i : {5, 64, 65, 130}) {
+        bitset2.set(i);
+    }
+
+    EXPECT_EQ(3u, bitset1.intersection_count(bitset2));
+    EXPECT_EQ(3u, bitset2.intersection_count(bitset1));
+
+    EXPECT_TRUE(bitset1.intersects_from(bitset2, 0));
+    EXPECT_TRUE(bitset1.intersects_from(bitset2, 65));
+    EXPECT_TRUE(bitset1.intersects_from(bitset2, 130));
+    EXPECT_FALSE(bitset1.intersects_from(bitset2, 131));
+    EXPECT_FALSE(bitset1.intersects_from(bitset2, 1000));
+
+    DynamicBitset intersection = DynamicBitset::intersection(bitset1, bitset2);
+
+    vector<unsigned> elements;
+    intersection.for_each([&elements] (unsigned i) {
+        elements.push_back(i);
+    });
+
+    EXPECT_EQ(vector<unsigned>({5, 64, 130}), elements);
+
+    EXPECT_TRUE(intersection.is_subset_of(bitset1));
+    EXPECT_TRUE(intersection.is_subset_of(bitset2));
+    EXPECT_FALSE(bitset1.is_subset_of(bitset2));
+    EXPECT_FALSE(bitset2.is_subset_of(intersection));
+}
@@ -0,0 +1,50 @@
+//
+//  frontier_indicators_test.cpp
+//  mco
+//
+//
+
+#include <vector>
+#include <limits>
+
+using std::vector;
+
+#include <gtest/gtest.h>
+
+#include <mco/basic/point.h>
+#include <mco/basic/frontier_indicators.h>
+
+using mco::Point;
+using mco::FrontierIndicators;
+
+TEST(FrontierIndicatorsTest, SameFrontier) {
+    vector<Point> frontier = { Point({1, 4}), Point({2, 2}), Point({4, 1}) };
+
+    EXPECT_DOUBLE_EQ(0, FrontierIndicators::multiplicative_epsilon(frontier, frontier));
+    EXPECT_DOUBLE_EQ(0, FrontierIndicators::additive_epsilon(frontier, frontier));
+    EXPECT_DOUBLE_EQ(1, FrontierIndicators::coverage(frontier, frontier));
+    EXPECT_DOUBLE_EQ(1, FrontierIndicators::hypervolume_ratio_2d(frontier, frontier));
+}
+
+TEST(FrontierIndicatorsTest, Subset) {
+    vector<Point> frontier = { Point({1, 4}), Point({2, 2}), Point({4, 1}) };
+    vector<Point> approximation = { Point({1, 4}), Point({4, 1}) };
+
+    // (2, 2) is best approximated by (1, 4)
+    EXPECT_DOUBLE_EQ(1, FrontierIndicators::multiplicative_epsilon(approximation, frontier));
+    EXPECT_DOUBLE_EQ(2, FrontierIndicators::additive_epsilon(approximation, frontier));
+    EXPECT_DOUBLE_EQ(2.0 / 3, FrontierIndicators::coverage(approximation, frontier));
+
+    // Reference point (5, 5)
+    EXPECT_DOUBLE_EQ(7, FrontierIndicators::hypervolume_2d(approximation, Point({5, 5})));
+    EXPECT_DOUBLE_EQ(11, FrontierIndicators::hypervolume_2d(frontier, Point({5, 5})));
+    EXPECT_DOUBLE_EQ(7.0 / 11, FrontierIndicators::hypervolume_ratio_2d(approximation, frontier));
+}
+
+TEST(FrontierIndicatorsTest, EmptyApproximation) {
+    vector<Point> frontier = { Point({1, 4}) };
+
+    EXPECT_EQ(std::numeric_limits<double>::infinity(),
+              FrontierIndicators::multiplicative_epsilon(vector<Point>(), frontier));
+    EXPECT_DOUBLE_EQ(0, FrontierIndicators::coverage(vector<Point>(), frontier));
+}
@@ -0,0 +1,75 @@
+//
+//  local_upper_bounds_test.cpp
+//  mco
+//
+//
+
+#include <vector>
+#include <limits>
+#include <random>
+
+using std::vector;
+
+#include <gtest/gtest.h>
+
+#include <mco/basic/point.h>
+#include <mco/basic/local_upper_bounds.h>
+
+using mco::Point;
+using mco::LocalUpperBounds;
+
+TEST(LocalUpperBoundsTest, BiObjective) {
+    LocalUpperBounds upper_bounds(Point({10, 10}));
+
+    upper_bounds.add(Point({2, 6}));
+    upper_bounds.add(Point({5, 3}));
+
+    ASSERT_EQ(3u, upper_bounds.bounds().size());
+
+    EXPECT_TRUE(upper_bounds.in_search_region(Point({1, 9})));
+    EXPECT_TRUE(upper_bounds.in_search_region(Point({4, 5})));
+    EXPECT_TRUE(upper_bounds.in_search_region(Point({9, 2})));
+
+    EXPECT_FALSE(upper_bounds.in_search_region(Point({2, 6})));
+    EXPECT_FALSE(upper_bounds.in_search_region(Point({6, 4})));
+    EXPECT_FALSE(upper_bounds.in_search_region(Point({1, 10})));
+}
+
+TEST(LocalUpperBoundsTest, DominatedPointsDoNotChangeBounds) {
+    LocalUpperBounds upper_bounds(Point({10, 10, 10}));
+
+    upper_bounds.add(Point({3, 3, 3}));
+    unsigned number_of_bounds = upper_bounds.bounds().size();
+
+    upper_bounds.add(Point({4, 3, 5}));
+    upper_bounds.add(Point({3, 3, 3}));
+
+    EXPECT_EQ(number_of_bounds, upper_bounds.bounds().size());
+}
+
+TEST(LocalUpperBoundsTest, RandomPointsThreeObjectives) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> value(0, 20);
+
+    double infinity = std::numeric_limits<double>::infinity();
+    LocalUpperBounds upper_bounds(Point({infinity, infinity, infinity}));
+    vector<Point> points;
+
+    for(unsigned k = 0; k < 40; ++k) {
+        Point point({double(value(generator)), double(value(generator)), double(value(generator))});
+        points.push_back(point);
+        upper_bounds.add(point);
+
+        for(unsigned j = 0; j < 200; ++j) {
+            Point query({double(value(generator)), double(value(generator)), double(value(generator))});
+
+            bool weakly_dominated = false;
+            for(auto& p : points) {
+                weakly_dominated = weakly_dominated ||
+                    (p[0] <= query[0] && p[1] <= query[1] && p[2] <= query[2]);
+            }
+
+            EXPECT_EQ(!weakly_dominated, upper_bounds.in_search_region(query));
+        }
+    }
+}
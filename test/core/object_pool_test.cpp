@@ -0,0 +1,80 @@
+//
+//  object_pool_test.cpp
+//  mco
+//
+//
+
+#include <vector>
+
+using std::vector;
+
+#include <gtest/gtest.h>
+
+#include <mco/basic/object_pool.h>
+
+using mco::ObjectPool;
+
+namespace {
+
+struct CountedObject {
+    CountedObject(int value, int& alive)
+    :   value(value), alive(alive) {
+        ++alive;
+    }
+
+    ~CountedObject() {
+        --alive;
+    }
+
+    int value;
+    int& alive;
+};
+
+}
+
+TEST(ObjectPoolTest, SlotsAreReused) {
+    int alive = 0;
+    ObjectPool<CountedObject> pool(4);
+
+    vector<CountedObject*> objects;
+    for(int i = 0; i < 6; ++i) {
+        objects.push_back(pool.create(i, alive));
+    }
+
+    EXPECT_EQ(6, alive);
+    EXPECT_EQ(6u, pool.size());
+    EXPECT_EQ(8u, pool.capacity());
+
+    for(int i = 0; i < 6; ++i) {
+        EXPECT_EQ(i, objects[i]->value);
+    }
+
+    CountedObject* destroyed = objects[2];
+    pool.destroy(destroyed);
+
+    EXPECT_EQ(5, alive);
+    EXPECT_EQ(5u, pool.size());
+
+    CountedObject* created = pool.create(42, alive);
+
+    EXPECT_EQ(destroyed, created);
+    EXPECT_EQ(42, created->value);
+    EXPECT_EQ(8u, pool.capacity());
+}
+
+TEST(ObjectPoolTest, DestroysAliveObjects) {
+    int alive = 0;
+
+    {
+        ObjectPool<CountedObject> pool(2);
+
+        CountedObject* object = pool.create(1, alive);
+        pool.create(2, alive);
+        pool.create(3, alive);
+        pool.destroy(object);
+
+        EXPECT_EQ(2, alive);
+    }
+
+    EXPECT_EQ(0, alive);
+}
@@ -7,10 +7,14 @@
 //
 
 #include <set>
+#include <list>
 #include <tuple>
 #include <string>
+#include <cstdio>
+#include <stdexcept>
 
 using std::set;
+using std::list;
 using std::tuple;
 using std::string;
 using std::get;
@@ -26,14 +30,18 @@ using ogdf::Graph;
 using ogdf::node;
 using ogdf::edge;
 using ogdf::EdgeArray;
+using ogdf::NodeArray;
 
 #include <mco/basic/point.h>
 #include <mco/benchmarks/temporary_graphs_parser.h>
 #include <mco/ep/dual_benson/ep_dual_benson.h>
 #include <mco/generic/benson_dual/ove_cdd.h>
+#include <mco/generic/benson_dual/ove_fp_v2.h>
 
 using mco::Point;
 using mco::EPDualBensonSolver;
+using mco::EPDichotomicSolver;
+using mco::GraphlessOVE;
 using mco::TemporaryGraphParser;
 using mco::OnlineVertexEnumeratorCDD;
 
@@ -79,6 +87,54 @@ TEST_P(ParetoInstanceTestFixture, CountMatch) {
     EXPECT_EQ(expected_number_of_minimizers_, solver.solutions().size());
 }
 
+TEST_P(ParetoInstanceTestFixture, DichotomicMatch) {
+    Graph graph;
+    EdgeArray<Point> costs(graph);
+    unsigned dimension;
+    node source;
+    node target;
+    
+    TemporaryGraphParser parser;
+    
+    parser.getGraph(filename_, graph, costs, dimension, source, target);
+    
+    auto weight_function = [costs] (edge e) {
+        return &costs(e);
+    };
+    
+    EPDualBensonSolver<GraphlessOVE> benson_solver;
+    benson_solver.Solve(graph, weight_function, source, target);
+    
+    unsigned number_of_callbacks = 0;
+    
+    EPDichotomicSolver dichotomic_solver(1E-8, 4);
+    dichotomic_solver.Solve(graph,
+                            weight_function,
+                            source,
+                            target,
+                            [&] (NodeArray<Point*>&, NodeArray<edge>&) {
+                                ++number_of_callbacks;
+                            });
+    
+    set<Point, mco::LexPointComparator> benson_points;
+    for(auto& solution : benson_solver.solutions()) {
+        benson_points.insert(solution.second);
+    }
+    
+    set<Point, mco::LexPointComparator> dichotomic_points;
+    for(auto& solution : dichotomic_solver.solutions()) {
+        dichotomic_points.insert(solution.second);
+    }
+    
+    EXPECT_EQ(expected_number_of_minimizers_, dichotomic_solver.solutions().size());
+    EXPECT_EQ(expected_number_of_minimizers_, number_of_callbacks);
+    EXPECT_EQ(benson_points.size(), dichotomic_points.size());
+    
+    for(auto& point : benson_points) {
+        EXPECT_EQ(1u, dichotomic_points.count(point));
+    }
+}
+
 INSTANTIATE_TEST_CASE_P(InstanceTests,
                         ParetoInstanceTestFixture,
                         Values(
@@ -86,3 +142,92 @@ INSTANTIATE_TEST_CASE_P(InstanceTests,
                                make_tuple(string("../../../instances/ep/grid50_1_1"), (unsigned) 2),
                                make_tuple(string("../../../instances/ep/grid50_50_7"), (unsigned) 13)
                                ));
+
+TEST(EPDualBensonSolverTest, ResumeCallbacks) {
+    Graph graph;
+    EdgeArray<Point> costs(graph);
+    unsigned dimension;
+    node source;
+    node target;
+    
+    TemporaryGraphParser parser;
+    
+    parser.getGraph("../../../instances/ep/grid50_50_7", graph, costs, dimension, source, target);
+    
+    auto weight_function = [costs] (edge e) {
+        return &costs(e);
+    };
+    
+    unsigned interrupt = 0;
+    list<Point> callback_points;
+    
+    // Records the points at the target and throws at the interrupt-th
+    // callback
+    auto callback = [&] (NodeArray<Point*>& distance, NodeArray<edge>&) {
+        if(callback_points.size() + 1 == interrupt) {
+            throw std::runtime_error("interrupted");
+        }
+        
+        Point& target_cost = *distance[target];
+        Point value(dimension);
+        for(unsigned i = 0; i < dimension; ++i) {
+            value[i] = target_cost[i + 1];
+        }
+        
+        callback_points.push_back(value);
+    };
+    
+    EPDualBensonSolver<GraphlessOVE> solver;
+    solver.Solve(graph, weight_function, source, target, callback);
+    
+    list<Point> uninterrupted_points = callback_points;
+    
+    string checkpoint_file = "ep_dual_benson_checkpoint.bin";
+    
+    // The first point is found before the first checkpoint
+    callback_points.clear();
+    interrupt = uninterrupted_points.size() / 2 + 1;
+    
+    EPDualBensonSolver<GraphlessOVE> interrupted_solver;
+    EXPECT_THROW(interrupted_solver.Solve(graph,
+                                          weight_function,
+                                          source,
+                                          target,
+                                          checkpoint_file,
+                                          0,
+                                          callback),
+                 std::runtime_error);
+    
+    list<Point> interrupted_points = callback_points;
+    
+    callback_points.clear();
+    interrupt = 0;
+    
+    EPDualBensonSolver<GraphlessOVE> resumed_solver;
+    resumed_solver.Resume(graph,
+                          weight_function,
+                          source,
+                          target,
+                          checkpoint_file,
+                          0,
+                          callback);
+    
+    std::remove(checkpoint_file.c_str());
+    
+    // Every point is passed to the callback exactly once over the
+    // interrupted and the resumed run
+    set<Point, mco::LexPointComparator> points(interrupted_points.begin(),
+                                                interrupted_points.end());
+    for(auto& point : callback_points) {
+        EXPECT_TRUE(points.insert(point).second);
+    }
+    
+    EXPECT_EQ(uninterrupted_points.size(),
+              interrupted_points.size() + callback_points.size());
+    EXPECT_EQ(uninterrupted_points.size(), points.size());
+    for(auto& point : uninterrupted_points) {
+        EXPECT_EQ(1u, points.count(point));
+    }
+    
+    EXPECT_EQ(solver.solutions().size(), resumed_solver.solutions().size());
+}
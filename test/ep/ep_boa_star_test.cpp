@@ -0,0 +1,50 @@
+//
+//  ep_boa_star_test.cpp
+//  mco
+//
+//
+
+#include <string>
+
+using std::string;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/boa_star/ep_boa_star.h>
+
+#include "ep_test_instance.h"
+
+using mco::EpSolverMartins;
+using mco::EpSolverBOAStar;
+using mco::EpInstanceTestFixture;
+
+class BOAStarInstanceTestFixture
+: public EpInstanceTestFixture { };
+
+TEST_P(BOAStarInstanceTestFixture, SameFrontierAsMartins) {
+    for(bool directed : {false, true}) {
+        EpSolverMartins martins;
+        martins.set_verbose(false);
+        martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        EpSolverBOAStar boa_star;
+        boa_star.Solve(graph_, weight_function(), source_, target_, directed);
+
+        EXPECT_EQ(frontier(martins), frontier(boa_star));
+        EXPECT_EQ(martins.solutions().size(), boa_star.solutions().size());
+        EXPECT_LE(boa_star.extracted_labels(), boa_star.created_labels());
+
+        // The paths are reported with their costs
+        expect_paths(boa_star, costs_, source_, target_, directed);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        BOAStarInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
@@ -0,0 +1,175 @@
+//
+//  ep_contraction_hierarchy_test.cpp
+//  mco
+//
+//
+
+#include <map>
+#include <vector>
+#include <string>
+#include <sstream>
+
+using std::map;
+using std::vector;
+using std::string;
+using std::stringstream;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::node;
+
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/contraction/ep_contraction_hierarchy.h>
+
+#include "ep_test_instance.h"
+
+using mco::EpSolverMartins;
+using mco::EpContractionHierarchy;
+using mco::EpSolverContractionHierarchy;
+using mco::EpInstanceTestFixture;
+
+class ContractionHierarchyInstanceTestFixture
+: public EpInstanceTestFixture {
+protected:
+    // Building the hierarchy dominates the running time, so it is built
+    // once per instance. Since the hierarchy refers to the nodes of the
+    // graph it was built on, it is kept in its written form and read for
+    // the graph of every test.
+    void SetUp() override {
+        EpInstanceTestFixture::SetUp();
+
+        string& written_hierarchy = written_hierarchies_[filename_];
+
+        if(written_hierarchy.empty()) {
+            EpContractionHierarchy hierarchy;
+            hierarchy.build(graph_, weight_function(), dimension_, false);
+
+            stringstream stream;
+            hierarchy.write(stream);
+            written_hierarchy = stream.str();
+        }
+
+        stringstream stream(written_hierarchy);
+        ASSERT_TRUE(hierarchy_.read(stream, graph_));
+    }
+
+    static void TearDownTestCase() {
+        written_hierarchies_.clear();
+    }
+
+    // Lines of the written hierarchy
+    vector<string> written_lines() const {
+        vector<string> lines;
+        stringstream stream(written_hierarchies_[filename_]);
+
+        string line;
+        while(std::getline(stream, line)) {
+            lines.push_back(line);
+        }
+
+        return lines;
+    }
+
+    bool read(const vector<string>& lines) {
+        stringstream stream;
+        for(auto& line : lines) {
+            stream << line << "\n";
+        }
+
+        EpContractionHierarchy hierarchy;
+        return hierarchy.read(stream, graph_);
+    }
+
+    EpContractionHierarchy hierarchy_;
+
+    static map<string, string> written_hierarchies_;
+};
+
+map<string, string> ContractionHierarchyInstanceTestFixture::written_hierarchies_;
+
+TEST_P(ContractionHierarchyInstanceTestFixture, SameFrontierAsMartins) {
+    vector<node> nodes;
+    for(auto n : graph_.nodes) {
+        nodes.push_back(n);
+    }
+
+    EpSolverContractionHierarchy query(hierarchy_);
+
+    for(unsigned i = 0; i < 5; ++i) {
+        node query_source = i == 0 ? source_ : nodes[(97 * i) % nodes.size()];
+        node query_target = i == 0 ? target_ : nodes[(31 * i + 1000) % nodes.size()];
+
+        EpSolverMartins martins;
+        martins.set_verbose(false);
+        martins.Solve(graph_, weight_function(), dimension_, query_source, query_target, false);
+
+        query.Solve(query_source, query_target);
+
+        EXPECT_EQ(frontier(martins), frontier(query));
+        expect_paths(query, costs_, query_source, query_target, false);
+    }
+}
+
+TEST_P(ContractionHierarchyInstanceTestFixture, ReadWrittenHierarchy) {
+    stringstream stream;
+    hierarchy_.write(stream);
+
+    EXPECT_EQ(written_hierarchies_[filename_], stream.str());
+
+    EXPECT_FALSE(read({"mco-ch 2 0 1 1"}));
+
+    vector<string> lines = written_lines();
+    ASSERT_TRUE(read(lines));
+
+    // Truncated
+    EXPECT_FALSE(read(vector<string>(lines.begin(), lines.begin() + lines.size() / 2)));
+
+    // The first shortcut, which is "s middle first second cost..."
+    unsigned number_of_nodes = graph_.maxNodeIndex() + 1;
+    unsigned shortcut = 2;
+    while(shortcut < lines.size() && lines[shortcut].compare(0, 2, "s ") != 0) {
+        ++shortcut;
+    }
+
+    ASSERT_LT(shortcut, lines.size());
+
+    stringstream line(lines[shortcut]);
+    string type;
+    unsigned middle, first, second;
+    line >> type >> middle >> first >> second;
+
+    string costs;
+    std::getline(line, costs);
+
+    auto replaced = [&] (unsigned new_middle, unsigned new_first, unsigned new_second) {
+        vector<string> broken_lines = lines;
+        broken_lines[shortcut] = "s " + std::to_string(new_middle)
+            + " " + std::to_string(new_first)
+            + " " + std::to_string(new_second) + costs;
+        return broken_lines;
+    };
+
+    unsigned index = shortcut - 2;
+
+    EXPECT_TRUE(read(replaced(middle, first, second)));
+
+    // Middle node out of range
+    EXPECT_FALSE(read(replaced(number_of_nodes, first, second)));
+
+    // Entries which do not exist before the shortcut, e.g., the shortcut
+    // itself, such that unpacking would not terminate
+    EXPECT_FALSE(read(replaced(middle, index, second)));
+    EXPECT_FALSE(read(replaced(middle, first, index)));
+    EXPECT_FALSE(read(replaced(middle, index + 1, second)));
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        ContractionHierarchyInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
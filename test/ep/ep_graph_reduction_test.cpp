@@ -0,0 +1,176 @@
+//
+//  ep_graph_reduction_test.cpp
+//  mco
+//
+//
+
+#include <set>
+#include <vector>
+#include <string>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+
+using std::set;
+using std::vector;
+using std::string;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::node;
+using ogdf::edge;
+using ogdf::EdgeArray;
+using ogdf::NodeArray;
+
+#include <mco/basic/point.h>
+#include <mco/ep/basic/dijkstra.h>
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/preprocessing/ep_graph_reduction.h>
+
+#include "ep_test_instance.h"
+
+using mco::Point;
+using mco::Dijkstra;
+using mco::DijkstraModes;
+using mco::EpSolverMartins;
+using mco::EpGraphReduction;
+using mco::EpInstanceTestFixture;
+
+class GraphReductionInstanceTestFixture
+: public EpInstanceTestFixture {
+protected:
+    // Rounded points of the solutions within bound
+    static set<vector<double>> bounded_frontier(const EpSolverMartins& solver,
+                                                const Point& bound) {
+        set<vector<double>> points;
+        for(auto& solution : solver.solutions()) {
+            if(std::equal(solution.second.cbegin(), solution.second.cend(),
+                          bound.cbegin(), std::less_equal<double>())) {
+                vector<double> point(solution.second.cbegin(), solution.second.cend());
+                for(auto& value : point) {
+                    value = std::round(value * 1E6) / 1E6;
+                }
+                points.insert(point);
+            }
+        }
+        return points;
+    }
+
+    // Distances from root in every objective
+    vector<NodeArray<double>> distances(node root,
+                                        std::function<bool(node, edge)> mode) const {
+        vector<NodeArray<double>> result(dimension_, NodeArray<double>(graph_));
+        NodeArray<edge> predecessors(graph_);
+
+        const EdgeArray<Point>& costs = costs_;
+        for(unsigned i = 0; i < dimension_; ++i) {
+            Dijkstra<double>().singleSourceShortestPaths(graph_,
+                                                         [&costs, i] (edge e) { return costs[e][i]; },
+                                                         root,
+                                                         predecessors,
+                                                         result[i],
+                                                         mode);
+        }
+
+        return result;
+    }
+};
+
+TEST_P(GraphReductionInstanceTestFixture, SameFrontier) {
+    for(bool directed : {false, true}) {
+        EpSolverMartins martins(1E-8);
+        martins.set_verbose(false);
+        martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        // Halfway between the ideal and the nadir point of the frontier,
+        // such that the bound cuts off a part of the frontier. The bound
+        // is raised to some point of the frontier, which is then exactly
+        // on the bound.
+        Point ideal(std::numeric_limits<double>::infinity(), dimension_);
+        Point nadir(-std::numeric_limits<double>::infinity(), dimension_);
+        for(auto& solution : martins.solutions()) {
+            for(unsigned i = 0; i < dimension_; ++i) {
+                ideal[i] = std::min(ideal[i], solution.second[i]);
+                nadir[i] = std::max(nadir[i], solution.second[i]);
+            }
+        }
+
+        Point no_bound(std::numeric_limits<double>::infinity(), dimension_);
+        Point bound = (ideal + nadir) * 0.5;
+
+        const Point& tight_point = martins.solutions().front().second;
+        for(unsigned i = 0; i < dimension_; ++i) {
+            bound[i] = std::max(bound[i], tight_point[i]);
+        }
+
+        auto source_distances = distances(source_, directed ? DijkstraModes::Forward
+                                                            : DijkstraModes::Undirected);
+        auto target_distances = distances(target_, directed ? DijkstraModes::Backward
+                                                            : DijkstraModes::Undirected);
+
+        for(bool bounded : {false, true}) {
+            // The lower bounds of the nodes are rounded differently from
+            // the costs of the paths
+            EpGraphReduction reduction(1E-6);
+
+            if(bounded) {
+                reduction.reduce(graph_, costs_, dimension_, source_, target_,
+                                 source_distances, target_distances, bound, directed);
+            } else {
+                reduction.reduce(graph_, costs_, dimension_, source_, target_,
+                                 {}, {}, no_bound, directed);
+            }
+
+            if(bounded) {
+                EXPECT_LT(reduction.graph().numberOfNodes(), graph_.numberOfNodes() * 4 / 5);
+            } else {
+                EXPECT_LE(reduction.graph().numberOfNodes(), graph_.numberOfNodes());
+            }
+
+            EdgeArray<Point>& reduced_costs = reduction.costs();
+
+            EpSolverMartins reduced_martins(1E-8);
+            reduced_martins.set_verbose(false);
+            reduced_martins.Solve(reduction.graph(),
+                                  [&reduced_costs] (edge e) { return &reduced_costs[e]; },
+                                  dimension_,
+                                  reduction.source(),
+                                  reduction.target(),
+                                  directed);
+
+            const Point& used_bound = bounded ? bound : no_bound;
+
+            // Paths beyond the bound may survive the reduction, but they
+            // do not dominate paths within the bound
+            auto expected = bounded_frontier(martins, used_bound);
+            EXPECT_FALSE(expected.empty());
+            EXPECT_EQ(expected, bounded_frontier(reduced_martins, used_bound));
+
+            if(!bounded) {
+                EXPECT_EQ(martins.solutions().size(), reduced_martins.solutions().size());
+            }
+
+            // Every path maps to an original path of the same cost
+            for(auto& solution : reduced_martins.solutions()) {
+                expect_path(reduction.original_path(solution.first),
+                            solution.second,
+                            costs_,
+                            source_,
+                            target_,
+                            directed);
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        GraphReductionInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
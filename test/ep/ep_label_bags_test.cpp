@@ -0,0 +1,105 @@
+//
+//  ep_label_bags_test.cpp
+//  mco
+//
+//
+
+#include <vector>
+#include <string>
+
+using std::vector;
+using std::string;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+
+#include <mco/basic/point.h>
+#include <mco/ep/basic/ep_label_bags.h>
+#include <mco/ep/basic/ep_mapped_label_bags.h>
+#include <mco/ep/martins/martins.h>
+
+#include "ep_test_instance.h"
+
+using mco::Point;
+using mco::EpLabelBags;
+using mco::EpMemoryLabelBags;
+using mco::EpMappedLabelBags;
+using mco::EpSolverMartins;
+using mco::EpInstanceTestFixture;
+
+TEST(EpMappedLabelBags, SameBagsAsInMemory) {
+    Graph graph;
+    vector<node> nodes;
+    for(unsigned i = 0; i < 50; ++i) {
+        nodes.push_back(graph.newNode());
+    }
+
+    EpMemoryLabelBags memory_bags;
+    EpMappedLabelBags mapped_bags("ep_label_bags_test.bin", 4096);
+
+    memory_bags.reset(graph, 3);
+    mapped_bags.reset(graph, 3);
+
+    // Adds to spilled bags as well
+    for(unsigned i = 0; i < 5000; ++i) {
+        Point cost(3);
+        cost[0] = i;
+        cost[1] = i % 7;
+        cost[2] = -1.0 * i;
+
+        node n = nodes[(i * i) % nodes.size()];
+        memory_bags.add(n, cost);
+        mapped_bags.add(n, cost);
+
+        EXPECT_LE(mapped_bags.resident_bytes(), 4096u);
+    }
+
+    EXPECT_LT(0u, mapped_bags.spills());
+    EXPECT_EQ(memory_bags.resident_bytes(),
+              mapped_bags.resident_bytes() + mapped_bags.spilled_bytes());
+
+    for(auto n : nodes) {
+        EpLabelBags::Bag memory_bag = memory_bags.bag(n);
+        EpLabelBags::Bag mapped_bag = mapped_bags.bag(n);
+
+        ASSERT_EQ(memory_bag.size, mapped_bag.size);
+        EXPECT_EQ(vector<double>(memory_bag.costs, memory_bag.costs + 3 * memory_bag.size),
+                  vector<double>(mapped_bag.costs, mapped_bag.costs + 3 * mapped_bag.size));
+    }
+}
+
+class LabelBagsInstanceTestFixture
+: public EpInstanceTestFixture { };
+
+TEST_P(LabelBagsInstanceTestFixture, SpilledMartins) {
+    for(bool directed : {false, true}) {
+        EpSolverMartins martins(1E-8);
+        martins.set_verbose(false);
+        martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        EpMappedLabelBags label_bags("ep_label_bags_test.bin", 1024);
+
+        EpSolverMartins spilled_martins(1E-8);
+        spilled_martins.set_verbose(false);
+        spilled_martins.set_label_bags(&label_bags);
+        spilled_martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        EXPECT_EQ(frontier(martins), frontier(spilled_martins));
+        EXPECT_LE(spilled_martins.peak_label_memory(), martins.peak_label_memory());
+
+        expect_paths(spilled_martins, costs_, source_, target_, directed);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        LabelBagsInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
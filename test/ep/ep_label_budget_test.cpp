@@ -0,0 +1,139 @@
+//
+//  ep_label_budget_test.cpp
+//  mco
+//
+//
+
+#include <string>
+#include <list>
+#include <utility>
+
+using std::string;
+using std::list;
+using std::pair;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::edge;
+
+#include <mco/basic/point.h>
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/brum_shier/ep_solver_bs.h>
+
+#include "ep_test_instance.h"
+
+using mco::Point;
+using mco::EpSolverMartins;
+using mco::EpSolverBS;
+using mco::EpInstanceTestFixture;
+
+namespace {
+
+/**
+ * Checks that every point of the frontier is approximated within a factor
+ * of 1 + epsilon.
+ */
+void expect_approximation(const list<pair<const list<edge>, const Point>>& frontier,
+                          const list<pair<const list<edge>, const Point>>& approximation,
+                          double epsilon) {
+    
+    for(auto& solution : frontier) {
+        bool approximated = false;
+        for(auto& approximate_solution : approximation) {
+            bool covers = true;
+            for(unsigned i = 0; i < solution.second.dimension(); ++i) {
+                if(approximate_solution.second[i] > (1 + epsilon) * solution.second[i] + 1E-6) {
+                    covers = false;
+                    break;
+                }
+            }
+            
+            if(covers) {
+                approximated = true;
+                break;
+            }
+        }
+        
+        EXPECT_TRUE(approximated) << solution.second[0] << " " << solution.second[1];
+    }
+}
+
+}
+
+class LabelBudgetInstanceTestFixture
+: public EpInstanceTestFixture { };
+
+TEST_P(LabelBudgetInstanceTestFixture, ApproximatesFrontier) {
+    for(bool directed : {false, true}) {
+        EpSolverMartins martins(1E-8);
+        martins.set_verbose(false);
+        martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+        
+        EXPECT_EQ(0, martins.achieved_epsilon());
+
+        EpSolverBS bs(1E-8);
+        bs.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+        
+        EXPECT_EQ(0, bs.achieved_epsilon());
+        EXPECT_EQ(martins.solutions().size(), bs.solutions().size());
+
+        for(unsigned budget : {20000u, 5000u}) {
+            EpSolverMartins budget_martins(1E-8);
+            budget_martins.set_verbose(false);
+            budget_martins.set_label_budget(budget);
+            budget_martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+            
+            EXPECT_LE(budget_martins.solutions().size(), martins.solutions().size());
+            expect_approximation(martins.solutions(),
+                                 budget_martins.solutions(),
+                                 budget_martins.achieved_epsilon());
+            
+            EpSolverBS budget_bs(1E-8);
+            budget_bs.set_label_budget(budget);
+            budget_bs.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+            
+            expect_approximation(martins.solutions(),
+                                 budget_bs.solutions(),
+                                 budget_bs.achieved_epsilon());
+        }
+    }
+}
+
+TEST_P(LabelBudgetInstanceTestFixture, StreamedTrees) {
+    EpSolverMartins martins(1E-8);
+    martins.set_verbose(false);
+    martins.Solve(graph_, weight_function(), dimension_, source_, target_, false);
+    
+    list<EpSolverMartins::DistanceTree> trees = first_phase_trees();
+    
+    // Merging also covers queued seeds, which already have successors
+    EpSolverMartins budget_martins(1E-8);
+    budget_martins.set_verbose(false);
+    budget_martins.set_label_budget(5000);
+    budget_martins.set_tree_stream([&trees] (EpSolverMartins::DistanceTree& tree) {
+        if(trees.empty()) {
+            return false;
+        }
+        
+        tree = trees.front();
+        trees.pop_front();
+        return true;
+    });
+    budget_martins.Solve(graph_, weight_function(), dimension_, source_, target_, false);
+    
+    expect_approximation(martins.solutions(),
+                         budget_martins.solutions(),
+                         budget_martins.achieved_epsilon());
+    expect_paths(budget_martins, costs_, source_, target_, false);
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        LabelBudgetInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
@@ -0,0 +1,92 @@
+//
+//  ep_landmarks_test.cpp
+//  mco
+//
+//
+
+#include <vector>
+#include <string>
+#include <limits>
+
+using std::vector;
+using std::string;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::node;
+using ogdf::edge;
+using ogdf::NodeArray;
+
+#include <mco/basic/point.h>
+#include <mco/ep/basic/dijkstra.h>
+#include <mco/ep/preprocessing/ep_landmarks.h>
+
+#include "ep_test_instance.h"
+
+using mco::Point;
+using mco::Dijkstra;
+using mco::DijkstraModes;
+using mco::EpLandmarks;
+using mco::EpInstanceTestFixture;
+
+class LandmarksInstanceTestFixture
+: public EpInstanceTestFixture { };
+
+TEST_P(LandmarksInstanceTestFixture, LowerBounds) {
+    for(bool directed : {false, true}) {
+        EpLandmarks landmarks(4);
+        landmarks.compute(graph_, weight_function(), dimension_, directed);
+
+        ASSERT_EQ(4u, landmarks.landmarks().size());
+
+        vector<node> targets = {target_, source_, landmarks.landmarks()[0]};
+
+        for(auto query_target : targets) {
+            auto heuristic = landmarks.heuristic(query_target);
+
+            for(unsigned i = 0; i < dimension_; ++i) {
+                Dijkstra<double> sssp_solver;
+                NodeArray<double> distances(graph_);
+                NodeArray<edge> predecessor(graph_);
+
+                auto length = [this, i] (edge e) {
+                    return costs_[e][i];
+                };
+
+                sssp_solver.singleSourceShortestPaths(graph_,
+                                                      length,
+                                                      query_target,
+                                                      predecessor,
+                                                      distances,
+                                                      directed ? DijkstraModes::Backward
+                                                               : DijkstraModes::Undirected);
+
+                for(auto n : graph_.nodes) {
+                    // target not reachable from n
+                    if(distances[n] == std::numeric_limits<double>::max()) {
+                        continue;
+                    }
+
+                    EXPECT_LE(heuristic(n, i), distances[n] + 1E-6);
+                    EXPECT_EQ(heuristic(n, i), landmarks.lower_bound(n, query_target, i));
+
+                    // Bounds towards a landmark are exact
+                    if(query_target == landmarks.landmarks()[0]) {
+                        EXPECT_NEAR(distances[n], heuristic(n, i), 1E-6);
+                    }
+                }
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        LandmarksInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
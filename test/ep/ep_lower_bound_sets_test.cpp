@@ -0,0 +1,62 @@
+//
+//  ep_lower_bound_sets_test.cpp
+//  mco
+//
+//
+
+#include <string>
+#include <limits>
+
+using std::string;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <mco/basic/point.h>
+#include <mco/basic/local_upper_bounds.h>
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/preprocessing/ep_lower_bound_sets.h>
+
+#include "ep_test_instance.h"
+
+using mco::Point;
+using mco::LocalUpperBounds;
+using mco::EpSolverMartins;
+using mco::EpLowerBoundSets;
+using mco::EpInstanceTestFixture;
+
+class LowerBoundSetsInstanceTestFixture
+: public EpInstanceTestFixture { };
+
+TEST_P(LowerBoundSetsInstanceTestFixture, SameFrontierAsMartins) {
+    EpLowerBoundSets lower_bound_sets;
+    lower_bound_sets.compute(graph_, weight_function(), source_, target_);
+
+    EXPECT_LE(dimension_, lower_bound_sets.number_of_hyperplanes());
+
+    for(bool directed : {false, true}) {
+        EpSolverMartins martins(1E-8);
+        martins.set_verbose(false);
+        martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        EpSolverMartins pruned_martins(1E-8);
+        pruned_martins.set_verbose(false);
+        pruned_martins.set_lower_bound_sets(&lower_bound_sets);
+        pruned_martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        EXPECT_EQ(frontier(martins), frontier(pruned_martins));
+        expect_paths(pruned_martins, costs_, source_, target_, directed);
+    }
+
+    // A label at the source can always reach the unbounded search region
+    LocalUpperBounds upper_bounds(Point(std::numeric_limits<double>::infinity(), dimension_));
+    EXPECT_TRUE(lower_bound_sets.may_improve(source_, Point(dimension_), upper_bounds));
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        LowerBoundSetsInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
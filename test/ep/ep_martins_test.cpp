@@ -0,0 +1,243 @@
+//
+//  ep_martins_test.cpp
+//  mco
+//
+//
+
+#include <list>
+#include <vector>
+#include <string>
+#include <thread>
+#include <utility>
+#include <limits>
+
+using std::list;
+using std::vector;
+using std::string;
+using std::thread;
+using std::pair;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::edge;
+using ogdf::NodeArray;
+
+#include <mco/basic/point.h>
+#include <mco/basic/concurrent_queue.h>
+#include <mco/basic/frontier_indicators.h>
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/dual_benson/ep_dual_benson.h>
+
+#include "ep_test_instance.h"
+
+using mco::Point;
+using mco::ConcurrentQueue;
+using mco::FrontierIndicators;
+using mco::EpSolverMartins;
+using mco::EPDualBensonSolver;
+using mco::EpInstanceTestFixture;
+
+class MartinsInstanceTestFixture
+: public EpInstanceTestFixture { };
+
+TEST_P(MartinsInstanceTestFixture, StreamedTrees) {
+    for(bool directed : {false, true}) {
+        EpSolverMartins martins(1E-8);
+        martins.set_verbose(false);
+        martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        ConcurrentQueue<EpSolverMartins::DistanceTree> trees;
+
+        thread first_phase([&] () {
+            auto callback = [&] (NodeArray<Point*>& distances,
+                                 NodeArray<edge>& predecessors) {
+
+                NodeArray<Point*> tree_distances(graph_);
+                for(auto n : graph_.nodes) {
+                    tree_distances[n] = new Point(dimension_);
+                    std::copy(distances[n]->cbegin() + 1, distances[n]->cend(),
+                              tree_distances[n]->begin());
+                }
+
+                trees.push(make_pair(tree_distances, predecessors));
+            };
+
+            EPDualBensonSolver<> solver;
+            solver.Solve(graph_, weight_function(), source_, target_, callback);
+        });
+
+        EpSolverMartins streamed_martins(1E-8);
+        streamed_martins.set_verbose(false);
+        streamed_martins.set_tree_stream([&trees] (EpSolverMartins::DistanceTree& tree) {
+            return trees.try_pop(tree);
+        });
+        streamed_martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        first_phase.join();
+
+        EpSolverMartins::DistanceTree tree;
+        while(trees.try_pop(tree)) {
+            for(auto n : graph_.nodes) {
+                delete tree.first[n];
+            }
+        }
+
+        EXPECT_EQ(frontier(martins), frontier(streamed_martins));
+    }
+}
+
+TEST_P(MartinsInstanceTestFixture, ReclaimedLabels) {
+    for(bool directed : {false, true}) {
+        EpSolverMartins martins(1E-8);
+        martins.set_verbose(false);
+        martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        EXPECT_LE(martins.final_label_memory(), martins.peak_label_memory());
+        EXPECT_LT(0u, martins.final_label_memory());
+
+        // The paths of the target labels survive reclaiming
+        expect_paths(martins, costs_, source_, target_, directed);
+    }
+}
+
+TEST_P(MartinsInstanceTestFixture, BeamSearch) {
+    EpSolverMartins martins(1E-8);
+    martins.set_verbose(false);
+    martins.Solve(graph_, weight_function(), dimension_, source_, target_, false);
+
+    vector<Point> frontier;
+    for(auto& solution : martins.solutions()) {
+        frontier.push_back(solution.second);
+    }
+
+    double last_epsilon = std::numeric_limits<double>::infinity();
+
+    for(unsigned beam_width : {2u, 8u, 1000u}) {
+        EpSolverMartins beam_martins(1E-8);
+        beam_martins.set_verbose(false);
+        beam_martins.set_beam_width(beam_width);
+        beam_martins.Solve(graph_, weight_function(), dimension_, source_, target_, false);
+
+        ASSERT_FALSE(beam_martins.solutions().empty());
+        EXPECT_LE(beam_martins.solutions().size(), beam_width);
+
+        vector<Point> approximation;
+        for(auto& solution : beam_martins.solutions()) {
+            approximation.push_back(solution.second);
+        }
+
+        // The beam finds paths, so it cannot beat the frontier
+        EXPECT_DOUBLE_EQ(1, FrontierIndicators::coverage(frontier, approximation, 1E-6));
+
+        last_epsilon = FrontierIndicators::multiplicative_epsilon(approximation, frontier);
+    }
+
+    // Wide enough beams are exact
+    EXPECT_NEAR(0, last_epsilon, 1E-9);
+}
+
+TEST_P(MartinsInstanceTestFixture, StreamedBeamSearch) {
+    list<EpSolverMartins::DistanceTree> trees = first_phase_trees();
+    
+    EpSolverMartins martins(1E-8);
+    martins.set_verbose(false);
+    martins.set_beam_width(2);
+    martins.set_tree_stream([&trees] (EpSolverMartins::DistanceTree& tree) {
+        if(trees.empty()) {
+            return false;
+        }
+        
+        tree = trees.front();
+        trees.pop_front();
+        return true;
+    });
+    martins.Solve(graph_, weight_function(), dimension_, source_, target_, false);
+    
+    // Seeded labels with successors stay in the beam
+    ASSERT_FALSE(martins.solutions().empty());
+    expect_paths(martins, costs_, source_, target_, false);
+}
+
+TEST(EpSolverMartinsTest, DominatedSeedWithSuccessors) {
+    ogdf::Graph graph;
+    ogdf::node s = graph.newNode();
+    ogdf::node a = graph.newNode();
+    ogdf::node b = graph.newNode();
+    ogdf::node c = graph.newNode();
+    ogdf::node d = graph.newNode();
+    ogdf::node t = graph.newNode();
+    
+    ogdf::EdgeArray<Point> costs(graph);
+    auto add_edge = [&] (ogdf::node v, ogdf::node w, double x, double y) {
+        edge e = graph.newEdge(v, w);
+        costs[e] = Point({x, y});
+        return e;
+    };
+    
+    edge sa = add_edge(s, a, 2, 2);
+    edge sc = add_edge(s, c, 1, 1);
+    edge ca = add_edge(c, a, 0.5, 0.5);
+    edge ab = add_edge(a, b, 1, 1);
+    edge sd = add_edge(s, d, 0.5, 5);
+    edge db = add_edge(d, b, 0.5, 0.5);
+    edge bt = add_edge(b, t, 1, 1);
+    
+    // Distances along the tree edges from the source
+    auto tree = [&] (vector<edge> tree_edges) {
+        EpSolverMartins::DistanceTree distance_tree(NodeArray<Point*>(graph, nullptr),
+                                                    NodeArray<edge>(graph, nullptr));
+        
+        distance_tree.first[s] = new Point({0, 0});
+        for(auto e : tree_edges) {
+            distance_tree.first[e->target()] = new Point(*distance_tree.first[e->source()] + costs[e]);
+            distance_tree.second[e->target()] = e;
+        }
+        
+        return distance_tree;
+    };
+    
+    // The second tree reaches a on a shorter path, which dominates the
+    // seed of the first tree at a, while the seed at b of the first tree
+    // stays nondominated
+    list<EpSolverMartins::DistanceTree> trees;
+    trees.push_back(tree({sa, sc, ab, sd, bt}));
+    trees.push_back(tree({sc, ca, sd, db, bt}));
+    
+    EpSolverMartins martins(1E-8);
+    martins.set_verbose(false);
+    martins.set_tree_stream([&trees] (EpSolverMartins::DistanceTree& distance_tree) {
+        if(trees.empty()) {
+            return false;
+        }
+        
+        distance_tree = trees.front();
+        trees.pop_front();
+        return true;
+    });
+    
+    // The first phase bound discards all extensions, so the seed at b
+    // outlives its dominated predecessor in the queue
+    martins.Solve(graph,
+                  [&costs] (edge e) { return &costs[e]; },
+                  2,
+                  s,
+                  t,
+                  Point(std::numeric_limits<double>::infinity(), 2),
+                  [] (ogdf::node, unsigned) { return 0; },
+                  list<Point>({Point({2, 2})}),
+                  true);
+    
+    EXPECT_EQ(2u, martins.solutions().size());
+    expect_paths(martins, costs, s, t, true);
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        MartinsInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
@@ -0,0 +1,218 @@
+//
+//  ep_query_server_test.cpp
+//  mco
+//
+//
+
+#include <set>
+#include <map>
+#include <list>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+
+using std::set;
+using std::map;
+using std::vector;
+using std::string;
+using std::stringstream;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::node;
+
+#include <mco/basic/point.h>
+#include <mco/basic/thread_pool.h>
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/preprocessing/ep_landmarks.h>
+#include <mco/ep/contraction/ep_contraction_hierarchy.h>
+#include <mco/ep/server/ep_query_server.h>
+
+#include "ep_test_instance.h"
+
+using mco::Point;
+using mco::ThreadPool;
+using mco::EpSolverMartins;
+using mco::EpLandmarks;
+using mco::EpContractionHierarchy;
+using mco::EpQueryServer;
+using mco::EpInstanceTestFixture;
+
+class QueryServerInstanceTestFixture
+: public EpInstanceTestFixture {
+protected:
+    // Queries with their expected responses; empty points stand for an
+    // error
+    void make_queries(unsigned number_of_queries) {
+        vector<node> nodes;
+        for(auto n : graph_.nodes) {
+            nodes.push_back(n);
+        }
+
+        for(unsigned i = 0; i < number_of_queries; ++i) {
+            node source = nodes[(97 * i) % nodes.size()];
+            node target = nodes[(31 * i + 1000) % nodes.size()];
+
+            EpSolverMartins martins(epsilon_);
+            martins.set_verbose(false);
+            martins.Solve(graph_, weight_function(), dimension_, source, target, false);
+
+            stringstream query;
+            query << source->index() << " " << target->index();
+
+            // Every other query bounds the first objective halfway between
+            // the extremes of the frontier
+            if(i % 2 == 1) {
+                double minimum = std::numeric_limits<double>::infinity();
+                double maximum = -std::numeric_limits<double>::infinity();
+                for(auto& solution : martins.solutions()) {
+                    minimum = std::min(minimum, solution.second[0]);
+                    maximum = std::max(maximum, solution.second[0]);
+                }
+
+                Point bounds(std::numeric_limits<double>::infinity(), dimension_);
+                bounds[0] = (minimum + maximum) / 2;
+
+                query.precision(std::numeric_limits<double>::max_digits10);
+                query << " " << bounds[0];
+
+                martins.Solve(graph_,
+                              weight_function(),
+                              dimension_,
+                              source,
+                              target,
+                              bounds,
+                              [] (node, unsigned) { return 0.0; },
+                              std::list<Point>(),
+                              false);
+            }
+
+            queries_.push_back(query.str());
+            expected_.push_back(frontier(martins));
+        }
+
+        for(string malformed : {"100000 0", "0", "x y", "0 1 1 2 3", "0 1 abc"}) {
+            queries_.push_back(malformed);
+            expected_.push_back(set<vector<double>>());
+        }
+    }
+
+    void expect_responses(EpQueryServer& server, ThreadPool& pool) {
+        stringstream input;
+        input << "# comment\n\n";
+        for(auto& query : queries_) {
+            input << query << "\n";
+        }
+
+        stringstream output;
+        server.serve_stream(input, output, pool);
+
+        // Responses are "query <id>: <n> points" followed by n points, or
+        // "query <id>: error: ..."
+        map<unsigned, set<vector<double>>> points;
+        set<unsigned> errors;
+
+        string line;
+        while(std::getline(output, line)) {
+            stringstream response(line);
+
+            string prefix, id_token, status;
+            response >> prefix >> id_token >> status;
+
+            ASSERT_EQ("query", prefix);
+            unsigned id = std::stoul(id_token);
+
+            EXPECT_TRUE(points.count(id) == 0 && errors.count(id) == 0) << id;
+
+            if(status == "error:") {
+                errors.insert(id);
+                continue;
+            }
+
+            unsigned number_of_points = std::stoul(status);
+            auto& query_points = points[id];
+
+            for(unsigned i = 0; i < number_of_points; ++i) {
+                ASSERT_TRUE(std::getline(output, line));
+                stringstream point_stream(line);
+
+                vector<double> point(dimension_);
+                for(auto& value : point) {
+                    point_stream >> value;
+                    value = std::round(value * 1E6) / 1E6;
+                }
+                query_points.insert(point);
+            }
+        }
+
+        // Every query is answered exactly once
+        EXPECT_EQ(queries_.size(), points.size() + errors.size());
+
+        for(unsigned id = 0; id < queries_.size(); ++id) {
+            if(expected_[id].empty()) {
+                EXPECT_EQ(1u, errors.count(id)) << queries_[id];
+            } else {
+                EXPECT_EQ(expected_[id], points[id]) << queries_[id];
+            }
+        }
+    }
+
+    // Bounds may be attained by a frontier point, whose heuristic costs
+    // exceed the bound by rounding errors
+    const double epsilon_ = 1E-6;
+
+    vector<string> queries_;
+    vector<set<vector<double>>> expected_;
+};
+
+TEST_P(QueryServerInstanceTestFixture, SameAnswersAsMartins) {
+    make_queries(12);
+
+    EpLandmarks landmarks(4);
+    landmarks.compute(graph_, weight_function(), dimension_, false);
+
+    ThreadPool pool(4);
+    EpQueryServer server(graph_, costs_, dimension_, false, epsilon_, landmarks, nullptr, pool.size());
+
+    expect_responses(server, pool);
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        QueryServerInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
+
+// Unbounded queries are answered by the contraction hierarchy, which is
+// only built for the smaller instance
+class QueryServerHierarchyTestFixture
+: public QueryServerInstanceTestFixture { };
+
+TEST_P(QueryServerHierarchyTestFixture, SameAnswersAsMartins) {
+    make_queries(12);
+
+    EpLandmarks landmarks(4);
+    landmarks.compute(graph_, weight_function(), dimension_, false);
+
+    EpContractionHierarchy hierarchy;
+    hierarchy.build(graph_, weight_function(), dimension_, false);
+
+    ThreadPool pool(4);
+    EpQueryServer server(graph_, costs_, dimension_, false, epsilon_, landmarks, &hierarchy, pool.size());
+
+    expect_responses(server, pool);
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        QueryServerHierarchyTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1")
+                               ));
@@ -0,0 +1,148 @@
+//
+//  ep_test_instance.h
+//  mco
+//
+//
+
+#ifndef __mco__ep_test_instance__
+#define __mco__ep_test_instance__
+
+#include <set>
+#include <list>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include <ogdf/basic/Graph.h>
+
+#include <mco/basic/point.h>
+#include <mco/benchmarks/temporary_graphs_parser.h>
+#include <mco/ep/dual_benson/ep_dual_benson.h>
+
+namespace mco {
+
+/**
+ * Fixture for tests on the EP instances given by their file names. The
+ * instance is read before every test.
+ */
+class EpInstanceTestFixture
+: public ::testing::TestWithParam<std::string> {
+protected:
+    EpInstanceTestFixture()
+    :   costs_(graph_) { }
+
+    void SetUp() override {
+        TemporaryGraphParser parser;
+        parser.getGraph(filename_, graph_, costs_, dimension_, source_, target_);
+    }
+
+    std::function<const Point*(ogdf::edge)> weight_function() const {
+        const ogdf::EdgeArray<Point>& costs = costs_;
+        return [&costs] (ogdf::edge e) {
+            return &costs[e];
+        };
+    }
+
+    /**
+     * Distance trees of the first phase, in the order of the dual Benson
+     * solver, e.g., to be streamed into Martins' algorithm.
+     */
+    std::list<std::pair<ogdf::NodeArray<Point*>, ogdf::NodeArray<ogdf::edge>>> first_phase_trees() {
+        std::list<std::pair<ogdf::NodeArray<Point*>, ogdf::NodeArray<ogdf::edge>>> trees;
+        
+        auto callback = [&] (ogdf::NodeArray<Point*>& distances,
+                             ogdf::NodeArray<ogdf::edge>& predecessors) {
+            
+            ogdf::NodeArray<Point*> tree_distances(graph_);
+            for(auto n : graph_.nodes) {
+                tree_distances[n] = new Point(dimension_);
+                std::copy(distances[n]->cbegin() + 1, distances[n]->cend(),
+                          tree_distances[n]->begin());
+            }
+            
+            trees.push_back(std::make_pair(tree_distances, predecessors));
+        };
+        
+        EPDualBensonSolver<> solver;
+        solver.Solve(graph_, weight_function(), source_, target_, callback);
+        
+        return trees;
+    }
+
+    const std::string filename_ = GetParam();
+
+    ogdf::Graph graph_;
+    ogdf::EdgeArray<Point> costs_;
+    unsigned dimension_;
+    ogdf::node source_;
+    ogdf::node target_;
+};
+
+/**
+ * Points of the solutions of solver, rounded to six decimal places, since
+ * different solvers sum up the costs in a different order.
+ */
+template<class Solver>
+std::set<std::vector<double>> frontier(const Solver& solver) {
+    std::set<std::vector<double>> points;
+    for(auto& solution : solver.solutions()) {
+        std::vector<double> point(solution.second.cbegin(), solution.second.cend());
+        for(auto& value : point) {
+            value = std::round(value * 1E6) / 1E6;
+        }
+        points.insert(point);
+    }
+    return points;
+}
+
+/**
+ * Checks that path is a walk from source to target whose costs sum up to
+ * value.
+ */
+inline void expect_path(const std::list<ogdf::edge>& path,
+                        const Point& value,
+                        const ogdf::EdgeArray<Point>& costs,
+                        ogdf::node source,
+                        ogdf::node target,
+                        bool directed) {
+
+    Point cost(0.0, value.dimension());
+    ogdf::node current = source;
+
+    for(auto e : path) {
+        if(directed) {
+            ASSERT_EQ(current, e->source());
+        } else {
+            ASSERT_TRUE(e->source() == current || e->target() == current);
+        }
+
+        current = e->opposite(current);
+        cost += costs[e];
+    }
+
+    EXPECT_EQ(target, current);
+    for(unsigned i = 0; i < value.dimension(); ++i) {
+        EXPECT_NEAR(value[i], cost[i], 1E-6);
+    }
+}
+
+template<class Solver>
+void expect_paths(const Solver& solver,
+                  const ogdf::EdgeArray<Point>& costs,
+                  ogdf::node source,
+                  ogdf::node target,
+                  bool directed) {
+
+    for(auto& solution : solver.solutions()) {
+        expect_path(solution.first, solution.second, costs, source, target, directed);
+    }
+}
+
+}
+
+#endif /* defined(__mco__ep_test_instance__) */
@@ -0,0 +1,52 @@
+//
+//  ep_tmda_test.cpp
+//  mco
+//
+//
+
+#include <string>
+
+using std::string;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/tmda/ep_solver_tmda.h>
+
+#include "ep_test_instance.h"
+
+using mco::EpSolverMartins;
+using mco::EpSolverTMDA;
+using mco::EpInstanceTestFixture;
+
+class TMDAInstanceTestFixture
+: public EpInstanceTestFixture { };
+
+TEST_P(TMDAInstanceTestFixture, SameFrontierAsMartins) {
+    for(bool directed : {false, true}) {
+        EpSolverMartins martins;
+        martins.set_verbose(false);
+        martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        EpSolverTMDA tmda;
+        tmda.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        EXPECT_EQ(frontier(martins), frontier(tmda));
+        EXPECT_EQ(martins.solutions().size(), tmda.solutions().size());
+
+        // At most one queued label per node
+        EXPECT_LE(tmda.max_queue_size(), graph_.numberOfNodes());
+
+        // The paths are reported with their costs
+        expect_paths(tmda, costs_, source_, target_, directed);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        TMDAInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
@@ -0,0 +1,50 @@
+//
+//  ep_two_phase_test.cpp
+//  mco
+//
+//
+
+#include <string>
+
+using std::string;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <mco/ep/martins/martins.h>
+#include <mco/ep/two_phase/ep_two_phase.h>
+
+#include "ep_test_instance.h"
+
+using mco::EpSolverMartins;
+using mco::EpSolverTwoPhase;
+using mco::EpInstanceTestFixture;
+
+class TwoPhaseInstanceTestFixture
+: public EpInstanceTestFixture { };
+
+TEST_P(TwoPhaseInstanceTestFixture, SameFrontierAsMartins) {
+    EpSolverMartins martins;
+    martins.set_verbose(false);
+    martins.Solve(graph_, weight_function(), dimension_, source_, target_, false);
+
+    for(unsigned threads : {1u, 4u}) {
+        EpSolverTwoPhase two_phase(0, threads);
+        two_phase.Solve(graph_, weight_function(), source_, target_);
+
+        EXPECT_EQ(frontier(martins), frontier(two_phase));
+        EXPECT_EQ(martins.solutions().size(), two_phase.solutions().size());
+        EXPECT_LE(1u, two_phase.number_of_triangles());
+
+        // The paths are reported with their costs
+        expect_paths(two_phase, costs_, source_, target_, false);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        TwoPhaseInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
@@ -0,0 +1,181 @@
+//
+//  ep_weighted_bs_test.cpp
+//  mco
+//
+//
+
+#include <vector>
+#include <string>
+#include <random>
+
+using std::vector;
+using std::string;
+
+#include <gtest/gtest.h>
+
+using ::testing::Values;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+using ogdf::edge;
+using ogdf::EdgeArray;
+
+#include <mco/basic/point.h>
+#include <mco/basic/abstract_solver.h>
+#include <mco/ep/brum_shier/ep_weighted_bs.h>
+#include <mco/ep/martins/weighted_martins.h>
+#include <mco/ep/dual_benson/ep_dual_benson.h>
+
+#include "ep_test_instance.h"
+
+using mco::Point;
+using mco::AbstractSolver;
+using mco::EpWeightedBS;
+using mco::EpWeightedMartins;
+using mco::EPDualBensonSolver;
+using mco::EpInstanceTestFixture;
+
+namespace {
+
+vector<Point> points(const AbstractSolver<std::list<edge>>& solver) {
+    vector<Point> result;
+    for(auto& solution : solver.solutions()) {
+        result.push_back(solution.second);
+    }
+    return result;
+}
+
+// Both point sets are equal up to epsilon
+void expect_same_points(const vector<Point>& expected,
+                        const vector<Point>& actual,
+                        double epsilon = 1E-6) {
+
+    EXPECT_EQ(expected.size(), actual.size());
+
+    for(auto& point : expected) {
+        bool found = false;
+        for(auto& other : actual) {
+            bool equal = true;
+            for(unsigned i = 0; i < point.dimension(); ++i) {
+                equal = equal && std::abs(point[i] - other[i]) <= epsilon;
+            }
+            found = found || equal;
+        }
+
+        EXPECT_TRUE(found) << point << " is missing";
+    }
+}
+
+// Random graph with a Hamiltonian path from source to target, such that
+// the target is reachable. Integral costs produce many ties.
+void random_graph(unsigned seed,
+                  unsigned number_nodes,
+                  unsigned number_edges,
+                  unsigned dimension,
+                  bool integral,
+                  Graph& graph,
+                  EdgeArray<Point>& costs,
+                  node& source,
+                  node& target) {
+
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> cost(1, 100);
+    std::uniform_int_distribution<unsigned> index(0, number_nodes - 1);
+
+    vector<node> nodes;
+    for(unsigned i = 0; i < number_nodes; ++i) {
+        nodes.push_back(graph.newNode());
+    }
+
+    costs.init(graph);
+
+    auto add_edge = [&] (node tail, node head) {
+        edge e = graph.newEdge(tail, head);
+        costs[e] = Point(dimension);
+        for(unsigned i = 0; i < dimension; ++i) {
+            costs[e][i] = integral ? std::floor(cost(generator) / 10) : cost(generator);
+        }
+    };
+
+    for(unsigned i = 0; i + 1 < number_nodes; ++i) {
+        add_edge(nodes[i], nodes[i + 1]);
+    }
+
+    for(unsigned i = number_nodes - 1; i < number_edges; ++i) {
+        node tail = nodes[index(generator)];
+        node head = nodes[index(generator)];
+        if(tail != head) {
+            add_edge(tail, head);
+        }
+    }
+
+    source = nodes.front();
+    target = nodes.back();
+}
+
+}
+
+class WeightedBSInstanceTestFixture
+: public EpInstanceTestFixture { };
+
+// Two objectives: the supported points are decided exactly, so both label
+// algorithms find the extreme points of the frontier
+TEST_P(WeightedBSInstanceTestFixture, ExtremePoints) {
+    EPDualBensonSolver<> benson;
+    benson.Solve(graph_, weight_function(), source_, target_);
+
+    for(bool directed : {false, true}) {
+        EpWeightedBS bs;
+        bs.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        EpWeightedMartins martins;
+        martins.Solve(graph_, weight_function(), dimension_, source_, target_, directed);
+
+        expect_same_points(points(martins), points(bs));
+
+        // The dual Benson solver works on the undirected graph
+        if(!directed) {
+            expect_same_points(points(benson), points(bs));
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceTests,
+                        WeightedBSInstanceTestFixture,
+                        Values(
+                               string("../../../instances/ep/grid50_1_1"),
+                               string("../../../instances/ep/grid50_50_7")
+                               ));
+
+// Three objectives: the supported points are decided up to the hull
+// epsilon, which suffices for random costs and for the ties of integral ones
+TEST(WeightedBSTest, ThreeObjectives) {
+    for(bool integral : {false, true}) {
+        for(unsigned seed = 1; seed <= 5; ++seed) {
+            Graph graph;
+            EdgeArray<Point> costs;
+            node source;
+            node target;
+
+            random_graph(seed, 60, 300, 3, integral, graph, costs, source, target);
+
+            auto weight_function = [&costs] (edge e) {
+                return &costs(e);
+            };
+
+            EpWeightedBS bs;
+            bs.Solve(graph, weight_function, 3, source, target, false);
+
+            EpWeightedMartins martins;
+            martins.Solve(graph, weight_function, 3, source, target, false);
+
+            EPDualBensonSolver<> benson;
+            benson.Solve(graph, weight_function, source, target);
+
+            expect_same_points(points(benson), points(bs));
+            expect_same_points(points(benson), points(martins));
+        }
+    }
+}
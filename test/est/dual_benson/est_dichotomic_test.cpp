@@ -0,0 +1,116 @@
+//
+//  est_dichotomic_test.cpp
+//  mco
+//
+//
+
+#include <set>
+#include <list>
+#include <vector>
+#include <random>
+
+using std::set;
+using std::list;
+using std::vector;
+
+#include <gtest/gtest.h>
+
+using ::testing::Range;
+
+#include <ogdf/basic/Graph.h>
+
+using ogdf::Graph;
+using ogdf::node;
+using ogdf::edge;
+using ogdf::EdgeArray;
+
+#include <mco/basic/point.h>
+#include <mco/basic/abstract_graph_instance.h>
+#include <mco/est/dual_benson/est_dual_benson_scalarizer.h>
+#include <mco/generic/benson_dual/dichotomic_scalarizer.h>
+#include <mco/generic/benson_dual/ove_fp_v2.h>
+
+using mco::Point;
+using mco::AbstractGraphInstance;
+using mco::ESTDualBensonScalarizer;
+using mco::LexKruskalSolverAdaptor;
+using mco::DichotomicScalarizer;
+using mco::GraphlessOVE;
+
+/**
+ * Random bi-objective spanning tree instances: a random tree plus random
+ * further edges. The costs are small integers, such that there are many
+ * ties.
+ */
+class ESTDichotomicTestFixture
+: public ::testing::TestWithParam<unsigned> { };
+
+TEST_P(ESTDichotomicTestFixture, SameExtremePointsAsDualBenson) {
+    std::mt19937 generator(GetParam());
+    std::uniform_int_distribution<int> cost_distribution(0, 20);
+    std::bernoulli_distribution edge_distribution(0.3);
+    
+    Graph graph;
+    EdgeArray<Point*> costs(graph);
+    
+    const unsigned number_of_nodes = 15;
+    
+    vector<node> nodes;
+    for(unsigned i = 0; i < number_of_nodes; ++i) {
+        nodes.push_back(graph.newNode());
+        
+        if(i > 0) {
+            std::uniform_int_distribution<unsigned> parent_distribution(0, i - 1);
+            graph.newEdge(nodes[parent_distribution(generator)], nodes[i]);
+        }
+    }
+    
+    for(unsigned i = 0; i < number_of_nodes; ++i) {
+        for(unsigned j = i + 1; j < number_of_nodes; ++j) {
+            if(edge_distribution(generator)) {
+                graph.newEdge(nodes[i], nodes[j]);
+            }
+        }
+    }
+    
+    for(auto e : graph.edges) {
+        costs[e] = new Point(2);
+        (*costs[e])[0] = cost_distribution(generator);
+        (*costs[e])[1] = cost_distribution(generator);
+    }
+    
+    AbstractGraphInstance instance(graph, costs, 2);
+    
+    ESTDualBensonScalarizer<GraphlessOVE> benson(instance);
+    benson.Solve();
+    
+    set<vector<double>> benson_points;
+    for(auto& solution : benson.solutions()) {
+        benson_points.insert(vector<double>(solution.second.cbegin(), solution.second.cend()));
+    }
+    
+    list<Point *> frontier;
+    
+    DichotomicScalarizer dichotomic([&instance] () {
+                                        return LexKruskalSolverAdaptor(instance);
+                                    },
+                                    1E-6,
+                                    4);
+    dichotomic.Calculate_solutions(frontier);
+    
+    set<vector<double>> dichotomic_points;
+    for(auto point : frontier) {
+        dichotomic_points.insert(vector<double>(point->cbegin(), point->cend()));
+        delete point;
+    }
+    
+    EXPECT_EQ(benson_points, dichotomic_points);
+    
+    for(auto e : graph.edges) {
+        delete costs[e];
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(RandomInstances,
+                        ESTDichotomicTestFixture,
+                        Range(1u, 11u));
@@ -0,0 +1,136 @@
+//
+//  lower_convex_hull_test.cpp
+//  mco
+//
+//
+
+#include <vector>
+#include <list>
+#include <set>
+#include <iterator>
+#include <random>
+#include <cmath>
+
+using std::vector;
+using std::list;
+using std::set;
+using std::back_inserter;
+
+#include <gtest/gtest.h>
+
+#include <mco/basic/point.h>
+#include <mco/geometric/lower_convex_hull.h>
+
+using mco::Point;
+using mco::IncrementalLowerHull;
+
+namespace {
+
+set<unsigned> payloads(const IncrementalLowerHull<unsigned>& hull) {
+    set<unsigned> result;
+    hull.for_each([&result] (unsigned payload) {
+        result.insert(payload);
+    });
+    return result;
+}
+
+}
+
+TEST(LowerConvexHullTest, TwoDimensionalChain) {
+    IncrementalLowerHull<unsigned> hull(2);
+    vector<unsigned> removed;
+
+    EXPECT_TRUE(hull.add_point(Point({0, 10}), 0, back_inserter(removed)));
+    EXPECT_TRUE(hull.add_point(Point({10, 0}), 1, back_inserter(removed)));
+
+    // above the segment
+    EXPECT_FALSE(hull.add_point(Point({5, 6}), 2, back_inserter(removed)));
+
+    // on the segment
+    EXPECT_FALSE(hull.add_point(Point({5, 5}), 3, back_inserter(removed)));
+
+    // dominated
+    EXPECT_FALSE(hull.add_point(Point({10, 1}), 4, back_inserter(removed)));
+
+    EXPECT_TRUE(hull.add_point(Point({4, 4}), 5, back_inserter(removed)));
+    EXPECT_TRUE(removed.empty());
+
+    EXPECT_TRUE(hull.add_point(Point({1, 7}), 6, back_inserter(removed)));
+    EXPECT_TRUE(removed.empty());
+
+    // makes (1, 7) and (4, 4) non-supported
+    EXPECT_TRUE(hull.add_point(Point({2, 2}), 7, back_inserter(removed)));
+    EXPECT_EQ(set<unsigned>({5, 6}), set<unsigned>(removed.begin(), removed.end()));
+    EXPECT_EQ(set<unsigned>({0, 1, 7}), payloads(hull));
+
+    removed.clear();
+
+    // dominates everything
+    EXPECT_TRUE(hull.add_point(Point({0, 0}), 8, back_inserter(removed)));
+    EXPECT_EQ(3u, removed.size());
+    EXPECT_EQ(1u, hull.size());
+}
+
+TEST(LowerConvexHullTest, ThreeDimensionalSimplex) {
+    IncrementalLowerHull<unsigned> hull(3);
+    vector<unsigned> removed;
+
+    EXPECT_TRUE(hull.add_point(Point({1, 0, 0}), 0, back_inserter(removed)));
+    EXPECT_TRUE(hull.add_point(Point({0, 1, 0}), 1, back_inserter(removed)));
+    EXPECT_TRUE(hull.add_point(Point({0, 0, 1}), 2, back_inserter(removed)));
+
+    EXPECT_FALSE(hull.add_point(Point({0.5, 0.5, 0.5}), 3, back_inserter(removed)));
+    EXPECT_FALSE(hull.add_point(Point({0.5, 0.5, 0}), 4, back_inserter(removed)));
+    EXPECT_FALSE(hull.add_point(Point({1, 1, 0}), 5, back_inserter(removed)));
+
+    EXPECT_TRUE(hull.add_point(Point({0.2, 0.2, 0.2}), 6, back_inserter(removed)));
+    EXPECT_TRUE(removed.empty());
+    EXPECT_EQ(4u, hull.size());
+
+    EXPECT_TRUE(hull.add_point(Point({0, 0, 0.5}), 7, back_inserter(removed)));
+    EXPECT_EQ(vector<unsigned>({2}), removed);
+    EXPECT_EQ(set<unsigned>({0, 1, 6, 7}), payloads(hull));
+}
+
+TEST(LowerConvexHullTest, SphereSurface) {
+    std::mt19937 generator(42);
+    std::normal_distribution<double> distribution;
+
+    for(unsigned dimension = 3; dimension <= 5; ++dimension) {
+        IncrementalLowerHull<unsigned> hull(dimension);
+        vector<unsigned> removed;
+
+        set<unsigned> expected;
+
+        for(unsigned i = 0; i < 60; ++i) {
+            Point direction(dimension);
+            double norm = 0;
+            for(unsigned j = 0; j < dimension; ++j) {
+                direction[j] = std::abs(distribution(generator));
+                norm += direction[j] * direction[j];
+            }
+            direction *= 1.0 / std::sqrt(norm);
+
+            // Points on the sphere are supported, points in its interior not
+            double radius = i % 3 == 0 ? 0.25 : 1.0;
+            Point point(1.0, dimension);
+            Point scaled = direction;
+            scaled *= radius;
+            point -= scaled;
+
+            bool supported = hull.add_point(point, i, back_inserter(removed));
+            if(radius == 1.0) {
+                EXPECT_TRUE(supported);
+                expected.insert(i);
+            }
+        }
+
+        for(auto payload : removed) {
+            expected.erase(payload);
+        }
+
+        EXPECT_TRUE(removed.size() <= 20);
+        EXPECT_EQ(expected, payloads(hull));
+        EXPECT_EQ(40u, hull.size());
+    }
+}
@@ -8,6 +8,13 @@
 
 #include <vector>
 #include <list>
+#include <set>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <random>
+#include <cstdio>
+#include <stdexcept>
 
 using std::vector;
 using std::list;
@@ -19,6 +26,7 @@ using ::testing::Values;
 
 #include <mco/basic/point.h>
 #include <mco/generic/benson_dual/ove_fp_v2.h>
+#include <mco/generic/benson_dual/dual_benson_scalarizer.h>
 
 using mco::Point;
 using mco::GraphlessOVE;
@@ -64,4 +72,339 @@ TEST(GraphlessOVETest, UnitCubeTest) {
         
         delete candidate;
     }
-}
\ No newline at end of file
+}
+TEST(GraphlessOVETest, SphereOctantTest) {
+    
+    // Every point is the unique minimizer of its normal as weighting,
+    // so all points are extreme points of the lower image
+    std::vector<Point> points;
+    for(unsigned i = 1; i < 12; ++i) {
+        for(unsigned j = 1; j < 12; ++j) {
+            double theta = M_PI / 2 * i / 12;
+            double phi = M_PI / 2 * j / 12;
+            
+            points.push_back(Point({
+                10 - 5 * std::sin(theta) * std::cos(phi),
+                10 - 5 * std::sin(theta) * std::sin(phi),
+                10 - 5 * std::cos(theta)
+            }));
+        }
+    }
+    
+    auto solver = [&points] (const Point& weighting, Point& value) {
+        double best = std::numeric_limits<double>::infinity();
+        for(auto& p : points) {
+            if(weighting * p < best) {
+                best = weighting * p;
+                value = p;
+            }
+        }
+        
+        return best;
+    };
+    
+    mco::DualBensonScalarizer<GraphlessOVE> scalarizer(solver, 3, 1E-8);
+    
+    list<Point *> solutions;
+    scalarizer.Calculate_solutions(solutions);
+    
+    std::set<std::vector<double>> distinct_solutions;
+    for(auto p : solutions) {
+        distinct_solutions.insert(std::vector<double>(p->cbegin(), p->cend()));
+        delete p;
+    }
+    
+    EXPECT_EQ(points.size(), solutions.size());
+    EXPECT_EQ(points.size(), distinct_solutions.size());
+}
+
+TEST(GraphlessOVETest, IntegerPointsTest) {
+    
+    // Small integer points have many ties, so that many vertices are on
+    // the new hyperplanes and have more active inequalities than necessary
+    std::mt19937 generator(5);
+    
+    std::vector<Point> points;
+    for(unsigned i = 0; i < 200; ++i) {
+        points.push_back(Point({
+            (double) (generator() % 21),
+            (double) (generator() % 21),
+            (double) (generator() % 21)
+        }));
+    }
+    
+    auto solver = [&points] (const Point& weighting, Point& value) {
+        double best = std::numeric_limits<double>::infinity();
+        for(auto& p : points) {
+            if(weighting * p < best) {
+                best = weighting * p;
+                value = p;
+            }
+        }
+        
+        return best;
+    };
+    
+    mco::DualBensonScalarizer<GraphlessOVE> scalarizer(solver, 3, 1E-8);
+    
+    list<Point *> solutions;
+    scalarizer.Calculate_solutions(solutions);
+    
+    // The solutions attain the minimum of every weighting
+    for(unsigned i = 0; i <= 20; ++i) {
+        for(unsigned j = 0; i + j <= 20; ++j) {
+            Point weighting({i / 20.0, j / 20.0, (20 - i - j) / 20.0});
+            
+            Point value(3);
+            double best = std::numeric_limits<double>::infinity();
+            for(auto p : solutions) {
+                best = std::min(best, weighting * *p);
+            }
+            
+            EXPECT_NEAR(solver(weighting, value), best, 1E-8);
+        }
+    }
+    
+    for(auto p : solutions) {
+        delete p;
+    }
+}
+
+TEST(GraphlessOVETest, DriftingCoordinatesTest) {
+    
+    // A tiny sphere octant far from the origin, so that the hyperplanes
+    // are almost parallel and the cut points drift far from the vertices
+    // of their active inequalities
+    std::vector<Point> points;
+    for(unsigned i = 1; i < 12; ++i) {
+        for(unsigned j = 1; j < 12; ++j) {
+            double theta = M_PI / 2 * i / 12;
+            double phi = M_PI / 2 * j / 12;
+            
+            points.push_back(Point({
+                1E5 - 1E-4 * std::sin(theta) * std::cos(phi),
+                1E5 - 1E-4 * std::sin(theta) * std::sin(phi),
+                1E5 - 1E-4 * std::cos(theta)
+            }));
+        }
+    }
+    
+    auto solver = [&points] (const Point& weighting, Point& value) {
+        double best = std::numeric_limits<double>::infinity();
+        for(auto& p : points) {
+            if(weighting * p < best) {
+                best = weighting * p;
+                value = p;
+            }
+        }
+        
+        return best;
+    };
+    
+    // The loop of DualBensonScalarizer, which keeps the enumerator
+    Point weighting({1, 0, 0});
+    Point value(3);
+    Point inequality(3);
+    
+    solver(weighting, value);
+    
+    GraphlessOVE ove(value, 3, 1E-8);
+    delete ove.next_vertex();
+    
+    std::set<std::vector<double>> solutions;
+    solutions.insert(std::vector<double>(value.cbegin(), value.cend()));
+    
+    double coordinate_error = 0;
+    
+    while(ove.has_next()) {
+        Point* candidate = ove.next_vertex();
+        
+        weighting[0] = (*candidate)[0];
+        weighting[1] = (*candidate)[1];
+        weighting[2] = 1 - (*candidate)[0] - (*candidate)[1];
+        
+        double scalar_value = solver(weighting, value);
+        
+        if(scalar_value - (*candidate)[2] <= -1E-8) {
+            for(unsigned i = 0; i < 2; ++i) {
+                inequality[i] = value[i] - value[2];
+            }
+            inequality[2] = -1;
+            
+            ove.add_hyperplane(*candidate, inequality, -value[2]);
+            solutions.insert(std::vector<double>(value.cbegin(), value.cend()));
+        }
+        
+        coordinate_error = std::max(coordinate_error, ove.coordinate_error());
+        
+        delete candidate;
+    }
+    
+    // The coordinates are far less accurate than 1E-12 relative to their
+    // magnitude, which the sides of the vertices must account for
+    EXPECT_GT(coordinate_error, 1E-12 * 1E5);
+    EXPECT_GT(ove.exact_evaluations(), 0u);
+    
+    EXPECT_EQ(points.size(), solutions.size());
+}
+
+TEST(GraphlessOVETest, CheckpointResumeTest) {
+    
+    std::vector<Point> points;
+    for(unsigned i = 1; i < 12; ++i) {
+        for(unsigned j = 1; j < 12; ++j) {
+            double theta = M_PI / 2 * i / 12;
+            double phi = M_PI / 2 * j / 12;
+            
+            points.push_back(Point({
+                10 - 5 * std::sin(theta) * std::cos(phi),
+                10 - 5 * std::sin(theta) * std::sin(phi),
+                10 - 5 * std::cos(theta)
+            }));
+        }
+    }
+    
+    unsigned calls = 0;
+    unsigned interrupt = 0;
+    
+    auto solver = [&] (const Point& weighting, Point& value) {
+        if(interrupt > 0 && calls == interrupt) {
+            throw std::runtime_error("interrupted");
+        }
+        ++calls;
+        
+        double best = std::numeric_limits<double>::infinity();
+        for(auto& p : points) {
+            if(weighting * p < best) {
+                best = weighting * p;
+                value = p;
+            }
+        }
+        
+        return best;
+    };
+    
+    auto distinct = [] (list<Point *>& solutions) {
+        std::set<std::vector<double>> distinct_solutions;
+        for(auto p : solutions) {
+            distinct_solutions.insert(std::vector<double>(p->cbegin(), p->cend()));
+            delete p;
+        }
+        
+        return distinct_solutions;
+    };
+    
+    list<Point *> solutions;
+    mco::DualBensonScalarizer<GraphlessOVE> scalarizer(solver, 3, 1E-8);
+    scalarizer.Calculate_solutions(solutions);
+    
+    unsigned uninterrupted_calls = calls;
+    auto uninterrupted_solutions = distinct(solutions);
+    
+    std::string checkpoint_file = "graphless_ove_checkpoint.bin";
+    
+    calls = 0;
+    interrupt = uninterrupted_calls / 2;
+    
+    list<Point *> interrupted_solutions;
+    mco::DualBensonScalarizer<GraphlessOVE> interrupted_scalarizer(solver, 3, 1E-8);
+    EXPECT_THROW(interrupted_scalarizer.Calculate_solutions(interrupted_solutions,
+                                                            checkpoint_file,
+                                                            0),
+                 std::runtime_error);
+    distinct(interrupted_solutions);
+    
+    calls = 0;
+    interrupt = 0;
+    
+    list<Point *> resumed_solutions;
+    mco::DualBensonScalarizer<GraphlessOVE> resumed_scalarizer(solver, 3, 1E-8);
+    resumed_scalarizer.Resume_solutions(resumed_solutions, checkpoint_file, 0);
+    
+    std::remove(checkpoint_file.c_str());
+    
+    // Only the scalarizations after the checkpoint are solved again
+    EXPECT_GT(calls, 0u);
+    EXPECT_LT(calls, uninterrupted_calls);
+    EXPECT_EQ(points.size(), resumed_solutions.size());
+    EXPECT_EQ(uninterrupted_solutions, distinct(resumed_solutions));
+}
+
+TEST(GraphlessOVETest, ApproximationTest) {
+    
+    std::vector<Point> points;
+    for(unsigned i = 1; i < 12; ++i) {
+        for(unsigned j = 1; j < 12; ++j) {
+            double theta = M_PI / 2 * i / 12;
+            double phi = M_PI / 2 * j / 12;
+            
+            points.push_back(Point({
+                10 - 5 * std::sin(theta) * std::cos(phi),
+                10 - 5 * std::sin(theta) * std::sin(phi),
+                10 - 5 * std::cos(theta)
+            }));
+        }
+    }
+    
+    unsigned calls = 0;
+    
+    auto solver = [&] (const Point& weighting, Point& value) {
+        ++calls;
+        
+        double best = std::numeric_limits<double>::infinity();
+        for(auto& p : points) {
+            if(weighting * p < best) {
+                best = weighting * p;
+                value = p;
+            }
+        }
+        
+        return best;
+    };
+    
+    list<Point *> exact_solutions;
+    mco::DualBensonScalarizer<GraphlessOVE> exact_scalarizer(solver, 3, 1E-8);
+    exact_scalarizer.Calculate_solutions(exact_solutions);
+    
+    unsigned exact_calls = calls;
+    EXPECT_EQ(0, exact_scalarizer.approximation_error());
+    
+    calls = 0;
+    
+    list<Point *> solutions;
+    mco::DualBensonScalarizer<GraphlessOVE> scalarizer(solver, 3, 1E-8);
+    scalarizer.set_approximation_tolerance(0.01);
+    scalarizer.Calculate_solutions(solutions);
+    
+    EXPECT_LT(calls, exact_calls);
+    EXPECT_LT(solutions.size(), exact_solutions.size());
+    EXPECT_GT(scalarizer.approximation_error(), 0);
+    
+    // The range of the values is at most 5
+    EXPECT_LE(scalarizer.approximation_error(), 0.05);
+    
+    // For every weighting, the solutions are at most the approximation
+    // error worse than the optimum
+    for(unsigned i = 0; i <= 20; ++i) {
+        for(unsigned j = 0; i + j <= 20; ++j) {
+            Point weighting({i / 20.0, j / 20.0, (20 - i - j) / 20.0});
+            
+            Point value(3);
+            double best = std::numeric_limits<double>::infinity();
+            for(auto p : solutions) {
+                best = std::min(best, weighting * *p);
+            }
+            
+            EXPECT_LE(best - solver(weighting, value),
+                      scalarizer.approximation_error() + 1E-8);
+        }
+    }
+    
+    for(auto p : exact_solutions) {
+        delete p;
+    }
+    
+    for(auto p : solutions) {
+        delete p;
+    }
+}
@@ -0,0 +1,114 @@
+//
+//  ove_planar_subdivision_test.cpp
+//  mco
+//
+//
+
+#include <vector>
+#include <list>
+#include <set>
+#include <cmath>
+#include <limits>
+#include <random>
+
+using std::vector;
+using std::list;
+using std::set;
+
+#include <gtest/gtest.h>
+
+#include <mco/basic/point.h>
+#include <mco/generic/benson_dual/ove_fp_v2.h>
+#include <mco/generic/benson_dual/ove_planar_subdivision.h>
+#include <mco/generic/benson_dual/dual_benson_scalarizer.h>
+
+using mco::Point;
+using mco::GraphlessOVE;
+using mco::PlanarSubdivisionOVE;
+using mco::DualBensonScalarizer;
+
+namespace {
+
+template<typename OnlineVertexEnumerator>
+set<vector<double>> extreme_points(const vector<Point>& points) {
+    auto solver = [&points] (const Point& weighting, Point& value) {
+        double best = std::numeric_limits<double>::infinity();
+        for(auto& p : points) {
+            if(weighting * p < best) {
+                best = weighting * p;
+                value = p;
+            }
+        }
+
+        return best;
+    };
+
+    DualBensonScalarizer<OnlineVertexEnumerator> scalarizer(solver, 3, 1E-8);
+
+    list<Point *> solutions;
+    scalarizer.Calculate_solutions(solutions);
+
+    set<vector<double>> distinct_solutions;
+    for(auto p : solutions) {
+        distinct_solutions.insert(vector<double>(p->cbegin(), p->cend()));
+        delete p;
+    }
+
+    return distinct_solutions;
+}
+
+}
+
+TEST(PlanarSubdivisionOVETest, SphereOctant) {
+    vector<Point> points;
+    for(unsigned i = 1; i < 12; ++i) {
+        for(unsigned j = 1; j < 12; ++j) {
+            double theta = M_PI / 2 * i / 12;
+            double phi = M_PI / 2 * j / 12;
+
+            points.push_back(Point({
+                10 - 5 * std::sin(theta) * std::cos(phi),
+                10 - 5 * std::sin(theta) * std::sin(phi),
+                10 - 5 * std::cos(theta)
+            }));
+        }
+    }
+
+    EXPECT_EQ(points.size(), extreme_points<PlanarSubdivisionOVE>(points).size());
+}
+
+TEST(PlanarSubdivisionOVETest, SameAsGraphlessOVE) {
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> coordinate(0, 20);
+
+    for(unsigned instance = 0; instance < 20; ++instance) {
+        vector<Point> points;
+        for(unsigned i = 0; i < 200; ++i) {
+            points.push_back(Point({
+                coordinate(generator),
+                coordinate(generator),
+                coordinate(generator)
+            }));
+        }
+
+        EXPECT_EQ(extreme_points<GraphlessOVE>(points),
+                  extreme_points<PlanarSubdivisionOVE>(points));
+    }
+}
+
+TEST(PlanarSubdivisionOVETest, DegeneratePoints) {
+    // All points are on one plane, so that many vertices are on the new
+    // hyperplanes. Only the corners of the triangle are extreme.
+    vector<Point> points;
+    for(unsigned i = 0; i < 6; ++i) {
+        for(unsigned j = 0; j + i < 6; ++j) {
+            points.push_back(Point({(double) i, (double) j, 10.0 - i - j}));
+        }
+    }
+
+    auto solutions = extreme_points<PlanarSubdivisionOVE>(points);
+
+    EXPECT_EQ(1u, solutions.count({0, 0, 10}));
+    EXPECT_EQ(1u, solutions.count({5, 0, 5}));
+    EXPECT_EQ(1u, solutions.count({0, 5, 5}));
+}
@@ -0,0 +1,90 @@
+//
+//  robust_predicates_test.cpp
+//  mco
+//
+//
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <mco/geometric/robust_predicates.h>
+
+using mco::Expansion;
+using mco::RobustPredicates;
+
+TEST(RobustPredicatesTest, ExpansionIsExact) {
+    Expansion expansion;
+    expansion.add(1E20);
+    expansion.add(1.0);
+    expansion.add(-1E20);
+
+    EXPECT_EQ(1, expansion.sign());
+    EXPECT_EQ(1.0, expansion.estimate());
+
+    expansion.add(-1.0);
+    EXPECT_EQ(0, expansion.sign());
+}
+
+TEST(RobustPredicatesTest, OrientationNearlyCollinear) {
+    EXPECT_GT(RobustPredicates::orientation2d(0, 0, 1, 0, 0, 1), 0);
+    EXPECT_LT(RobustPredicates::orientation2d(0, 0, 0, 1, 1, 0), 0);
+    EXPECT_EQ(0, RobustPredicates::orientation2d(0, 0, 1, 1, 3, 3));
+
+    // Points on the line y = x, perturbed by one ulp
+    double x = 0.5;
+    double y = std::nextafter(0.5, 1.0);
+
+    EXPECT_GT(RobustPredicates::orientation2d(12, 12, 24, 24, x, y), 0);
+    EXPECT_LT(RobustPredicates::orientation2d(12, 12, 24, 24, y, x), 0);
+    EXPECT_EQ(0, RobustPredicates::orientation2d(12, 12, 24, 24, x, x));
+}
+
+TEST(RobustPredicatesTest, ExpansionProduct) {
+    Expansion expansion1;
+    expansion1.add(1E20);
+    expansion1.add(1.0);
+
+    Expansion expansion2;
+    expansion2.add(1E20);
+    expansion2.add(-1.0);
+
+    // (10^20 + 1) (10^20 - 1) - 10^40 = -1
+    Expansion product = Expansion::product(expansion1, expansion2);
+    product.add_product(-1E20, 1E20);
+
+    EXPECT_EQ(-1, product.sign());
+    EXPECT_EQ(-1.0, product.estimate());
+}
+
+TEST(RobustPredicatesTest, DeterminantSign) {
+    EXPECT_EQ(1, RobustPredicates::determinant_sign({{1, 0, 0},
+                                                     {0, 1, 0},
+                                                     {0, 0, 1}}));
+    EXPECT_EQ(-1, RobustPredicates::determinant_sign({{0, 1, 0},
+                                                      {1, 0, 0},
+                                                      {0, 0, 1}}));
+    EXPECT_EQ(0, RobustPredicates::determinant_sign({{1, 2, 3},
+                                                     {4, 5, 6},
+                                                     {7, 8, 9}}));
+
+    // Singular up to one ulp in a single entry
+    double x = std::nextafter(0.3, 1.0);
+
+    EXPECT_EQ(0, RobustPredicates::determinant_sign({{0.1, 0.2, 0.3},
+                                                     {0.1, 0.2, 0.3},
+                                                     {1, 5, 7}}));
+    EXPECT_EQ(1, RobustPredicates::determinant_sign({{3, 0.3},
+                                                     {3, x}}));
+    EXPECT_EQ(-1, RobustPredicates::determinant_sign({{1, 0, 0, 0},
+                                                      {0, 3, x, 0},
+                                                      {0, 3, 0.3, 0},
+                                                      {0, 0, 0, 1}}));
+}
+
+TEST(RobustPredicatesTest, CompensatedDot) {
+    double a[] = {1E20, 1.0, -1E20};
+    double b[] = {1.0, 1.0, 1.0};
+
+    EXPECT_EQ(1.0, RobustPredicates::dot(a, b, 3));
+}
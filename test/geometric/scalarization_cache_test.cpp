@@ -0,0 +1,141 @@
+//
+//  scalarization_cache_test.cpp
+//  mco
+//
+//
+
+#include <vector>
+#include <list>
+#include <set>
+#include <limits>
+#include <random>
+
+using std::vector;
+using std::list;
+
+#include <gtest/gtest.h>
+
+#include <mco/basic/point.h>
+#include <mco/generic/benson_dual/scalarization_cache.h>
+#include <mco/generic/benson_dual/ove_fp_v2.h>
+#include <mco/generic/benson_dual/dual_benson_scalarizer.h>
+
+using mco::Point;
+using mco::ScalarizationCache;
+using mco::GraphlessOVE;
+
+namespace {
+    
+vector<Point> integer_points(unsigned dimension, unsigned number, unsigned range) {
+    std::mt19937 generator(5);
+    
+    vector<Point> points;
+    for(unsigned i = 0; i < number; ++i) {
+        Point point(dimension);
+        for(unsigned j = 0; j < dimension; ++j) {
+            point[j] = generator() % range;
+        }
+        points.push_back(point);
+    }
+    
+    return points;
+}
+    
+}
+
+TEST(ScalarizationCacheTest, SegmentTest) {
+    
+    vector<Point> points = {
+        Point({0, 4}),
+        Point({1, 1}),
+        Point({4, 0})
+    };
+    
+    unsigned calls = 0;
+    
+    auto solver = [&] (const Point& weighting, Point& value) {
+        ++calls;
+        
+        double best = std::numeric_limits<double>::infinity();
+        for(auto& p : points) {
+            if(weighting * p < best) {
+                best = weighting * p;
+                value = p;
+            }
+        }
+        
+        return best;
+    };
+    
+    ScalarizationCache cache(solver);
+    Point value(2);
+    
+    // (1, 1) is optimal from 1/4 to 3/4
+    EXPECT_DOUBLE_EQ(1, cache(Point({0.3, 0.7}), value));
+    EXPECT_DOUBLE_EQ(1, cache(Point({0.7, 0.3}), value));
+    EXPECT_EQ(2u, calls);
+    
+    value = Point(2);
+    EXPECT_DOUBLE_EQ(1, cache(Point({0.5, 0.5}), value));
+    EXPECT_DOUBLE_EQ(1, value[0]);
+    EXPECT_DOUBLE_EQ(1, value[1]);
+    EXPECT_DOUBLE_EQ(1, cache(Point({0.3, 0.7}), value));
+    EXPECT_EQ(2u, calls);
+    EXPECT_EQ(2u, cache.hits());
+    
+    // Not on a segment of known weightings of (1, 1)
+    EXPECT_DOUBLE_EQ(0.8, cache(Point({0.2, 0.8}), value));
+    EXPECT_DOUBLE_EQ(1, cache(Point({0.75, 0.25}), value));
+    EXPECT_EQ(4u, calls);
+    EXPECT_EQ(4u, cache.misses());
+}
+
+TEST(ScalarizationCacheTest, DualBensonTest) {
+    
+    // Degenerate points yield candidate vertices on the edges between
+    // permanent vertices
+    vector<Point> points = integer_points(4, 2000, 41);
+    
+    unsigned calls = 0;
+    
+    auto solver = [&] (const Point& weighting, Point& value) {
+        ++calls;
+        
+        double best = std::numeric_limits<double>::infinity();
+        for(auto& p : points) {
+            if(weighting * p < best) {
+                best = weighting * p;
+                value = p;
+            }
+        }
+        
+        return best;
+    };
+    
+    auto distinct = [] (list<Point *>& solutions) {
+        std::set<vector<double>> distinct_solutions;
+        for(auto p : solutions) {
+            distinct_solutions.insert(vector<double>(p->cbegin(), p->cend()));
+            delete p;
+        }
+        
+        return distinct_solutions;
+    };
+    
+    list<Point *> solutions;
+    mco::DualBensonScalarizer<GraphlessOVE> scalarizer(solver, 4, 1E-8);
+    scalarizer.Calculate_solutions(solutions);
+    
+    unsigned uncached_calls = calls;
+    calls = 0;
+    
+    ScalarizationCache cache(solver);
+    
+    list<Point *> cached_solutions;
+    mco::DualBensonScalarizer<GraphlessOVE> cached_scalarizer(std::ref(cache), 4, 1E-8);
+    cached_scalarizer.Calculate_solutions(cached_solutions);
+    
+    EXPECT_GT(cache.hits(), 0u);
+    EXPECT_EQ(uncached_calls, calls + cache.hits());
+    EXPECT_EQ(distinct(solutions), distinct(cached_solutions));
+}